@@ -103,6 +103,11 @@ class ChApi ChCollisionSystem {
     /// The default implementation does nothing. Derived classes implement this function as applicable.
     virtual void SetNumThreads(int nthreads) {}
 
+    /// Enable/disable generation of contacts in an order independent of the number of threads.
+    /// The default implementation does nothing (appropriate for collision systems which always report contacts in a
+    /// deterministic order). See ChSystem::EnableDeterministic.
+    virtual void SetDeterministic(bool val) {}
+
     /// After the Run() has completed, you can call this function to
     /// fill a 'contact container', that is an object inherited from class
     /// ChContactContainer. For instance ChSystem, after each Run()
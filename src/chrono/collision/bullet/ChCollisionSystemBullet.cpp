@@ -27,6 +27,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/utils/ChOpenMP.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -37,7 +38,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr), m_num_threads(1) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -125,6 +126,7 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(nthreads, 1);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -212,37 +214,63 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
 
-    // NOTE: Bullet does not provide information on radius of curvature at a contact point.
-    // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
-    ChCollisionInfo icontact;
-
     int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+    // Execute custom broadphase callback, if any.
+    // User callbacks are always invoked sequentially (they are not required to be thread-safe).
+    std::vector<char> do_narrow_contactgeneration;
+    if (broad_callback) {
+        do_narrow_contactgeneration.resize(numManifolds);
+        for (int i = 0; i < numManifolds; i++) {
+            cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+            auto bt_modelA = (ChCollisionModelBullet*)contactManifold->getBody0()->getUserPointer();
+            auto bt_modelB = (ChCollisionModelBullet*)contactManifold->getBody1()->getUserPointer();
+            do_narrow_contactgeneration[i] = broad_callback->OnBroadphase(bt_modelA->model, bt_modelB->model);
+        }
+    }
+
+    // Collect contacts from the persistent manifolds in per-thread batches.
+    // With a static schedule, each thread processes a contiguous range of manifolds. Merging the batches in thread
+    // order therefore reproduces the sequential contact ordering, independent of the number of threads.
+    if (m_contact_batches.size() < (size_t)m_num_threads)
+        m_contact_batches.resize(m_num_threads);
+    for (auto& batch : m_contact_batches)
+        batch.clear();
+
+#pragma omp parallel num_threads(m_num_threads)
+    {
+        auto& batch = m_contact_batches[ChOMP::GetThreadNum()];
+
+        // NOTE: Bullet does not provide information on radius of curvature at a contact point.
+        // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
+        ChCollisionInfo icontact;
 
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+#pragma omp for schedule(static)
+        for (int i = 0; i < numManifolds; i++) {
+            cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
+            const cbtCollisionObject* obA = contactManifold->getBody0();
+            const cbtCollisionObject* obB = contactManifold->getBody1();
+            contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+            if (broad_callback && !do_narrow_contactgeneration[i])
+                continue;
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+            auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+            auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+            icontact.modelA = bt_modelA->model;
+            icontact.modelB = bt_modelB->model;
+
+            double envelopeA = icontact.modelA->GetEnvelope();
+            double envelopeB = icontact.modelB->GetEnvelope();
+
+            double marginA = icontact.modelA->GetSafeMargin();
+            double marginB = icontact.modelB->GetSafeMargin();
+
+            bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+            bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
 
-        if (do_narrow_contactgeneration) {
             int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
             for (int j = 0; j < numContacts; j++) {
                 cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
@@ -266,35 +294,35 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
 
                     icontact.reaction_cache = pt.reactions_cache;
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-
                     int indexA = compoundA ? pt.m_index0 : 0;
                     int indexB = compoundB ? pt.m_index1 : 0;
 
                     icontact.shapeA = bt_modelA->m_shapes[indexA].get();
                     icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
-
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
-
-                        mcontactcontainer->AddContact(icontact);
-                    }
+                    batch.push_back(icontact);
                 }
             }
+
+            // Uncomment this line to remove all points
+            ////contactManifold->clearManifold();
         }
+    }
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+    // Merge the contact batches into the contact container
+    for (auto& batch : m_contact_batches) {
+        for (auto& icontact : batch) {
+            // Execute some user custom callback, if any
+            bool add_contact = true;
+            if (this->narrow_callback)
+                add_contact = this->narrow_callback->OnNarrowphase(icontact);
+
+            // Add to contact container
+            if (add_contact)
+                mcontactcontainer->AddContact(icontact);
+        }
     }
+
     mcontactcontainer->EndAddContact();
 }
 
@@ -50,6 +50,8 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     // virtual void RemoveAll();
 
     /// Set the number of OpenMP threads for collision detection.
+    /// Narrowphase collision detection on the broadphase overlapping pairs (if Bullet was built with OpenMP support)
+    /// and the extraction of contacts from the persistent manifolds (see ReportContacts) are done in parallel.
     virtual void SetNumThreads(int nthreads) override;
 
     /// Run the algorithm and finds all the contacts.
@@ -75,6 +77,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// The basic behavior of the implementation is the following: collision system
     /// will call in sequence the functions BeginAddContact(), AddContact() (x n times),
     /// EndAddContact() of the contact container.
+    /// Contacts are collected in parallel from the Bullet persistent manifolds, but they are always reported to the
+    /// contact container (and to any narrowphase callback) sequentially and in the same order, regardless of the number
+    /// of threads. Note that the broadphase callback (if any) is invoked sequentially for all overlapping pairs before
+    /// the manifolds are refreshed and any contact is passed to the narrowphase callback.
     virtual void ReportContacts(ChContactContainer* mcontactcontainer) override;
 
     /// After the Run() has completed, you can call this function to
@@ -160,6 +166,9 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    int m_num_threads;                                            ///< number of threads for collision detection
+    std::vector<std::vector<ChCollisionInfo>> m_contact_batches;  ///< per-thread contact batches
+
     friend class ChCollisionModelBullet;
 };
 
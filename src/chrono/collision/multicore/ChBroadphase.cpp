@@ -38,6 +38,7 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      deterministic(false),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -285,7 +286,10 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 
     // Find the number of active bins (i.e. with at least one shape AABB intersection)
-    Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+    if (deterministic)
+        thrust::stable_sort_by_key(THRUST_PAR bin_number.begin(), bin_number.end(), bin_aabb_number.begin());
+    else
+        Thrust_Sort_By_Key(bin_number, bin_aabb_number);
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
     if (num_active_bins <= 0) {
@@ -42,6 +42,11 @@ class ChApi ChBroadphase {
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Enable/disable deterministic ordering of the candidate shape pairs (default: false).
+    /// If enabled, the shapes in each bin are sorted with a stable sort, so that the list of candidate pairs does not
+    /// depend on the number of threads.
+    void EnableDeterministic(bool val) { deterministic = val; }
+
   private:
     void OneLevelBroadphase();
     void DetermineBoundingBox();
@@ -56,6 +61,7 @@ class ChApi ChBroadphase {
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    bool deterministic;    ///< (input) use stable sorting of bin-shape intersections
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
@@ -66,6 +66,10 @@ void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorith
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemMulticore::EnableNarrowphaseBatching(bool val) {
+    narrowphase.EnableBatching(val);
+}
+
 void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_min, const ChVector3d& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -79,6 +83,11 @@ void ChCollisionSystemMulticore::SetNumThreads(int nthreads) {
 #endif
 }
 
+void ChCollisionSystemMulticore::SetDeterministic(bool val) {
+    broadphase.EnableDeterministic(val);
+    narrowphase.EnableDeterministic(val);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemMulticore::Add(std::shared_ptr<ChCollisionModel> model) {
@@ -83,6 +83,10 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable/disable batched processing of sphere-sphere and box-sphere pairs in the narrowphase (default: true).
+    /// See ChNarrowphase.
+    void EnableNarrowphaseBatching(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -95,6 +99,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Set the number of OpenMP threads for collision detection.
     virtual void SetNumThreads(int nthreads) override;
 
+    /// Enable/disable generation of contacts in an order independent of the number of threads.
+    virtual void SetDeterministic(bool val) override;
+
     /// Synchronization operations, invoked before running the collision detection.
     /// This function copies contactable state information in the collision system's data structures.
     virtual void PreProcess() override;
@@ -37,6 +37,8 @@ using namespace chrono::mc_utils;
 
 ChNarrowphase::ChNarrowphase()
     : algorithm(Algorithm::HYBRID),
+      batching(true),
+      deterministic(false),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
@@ -268,8 +270,12 @@ void ChNarrowphase::DispatchPRIMS() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
+    // If batching is enabled, only process here the pairs not handled in batches
+    int num_pairs = batching ? (int)batch_other.size() : (int)num_potential_rigid_contacts;
+
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int i = 0; i < num_pairs; i++) {
+        uint index = batching ? batch_other[i] : (uint)i;
         uint ID_A, ID_B, icoll;
 
         int nC;
@@ -296,8 +302,12 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    // If batching is enabled, only process here the pairs not handled in batches
+    int num_pairs = batching ? (int)batch_other.size() : (int)num_potential_rigid_contacts;
+
 #pragma omp parallel for private(shapeA, shapeB)
-    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+    for (int i = 0; i < num_pairs; i++) {
+        uint index = batching ? batch_other[i] : (uint)i;
         uint ID_A, ID_B, icoll;
 
         int nC;
@@ -346,6 +356,11 @@ void ChNarrowphase::ProcessRigidRigid() {
     contact_rigid_active.resize(num_potentialContacts);
     thrust::fill(contact_rigid_active.begin(), contact_rigid_active.end(), false);
 
+    // Group pairs of primitive shapes for batched processing (not used with MPR)
+    bool use_batches = batching && algorithm != Algorithm::MPR;
+    if (use_batches)
+        PreprocessBatches();
+
     switch (algorithm) {
         case Algorithm::MPR:
             DispatchMPR();
@@ -358,6 +373,11 @@ void ChNarrowphase::ProcessRigidRigid() {
             break;
     }
 
+    if (use_batches) {
+        DispatchBatchSphereSphere();
+        DispatchBatchBoxSphere();
+    }
+
     // Calculate total number of actual (active) contacts
     num_rigid_contacts = (uint)Thrust_Count(contact_rigid_active, 1);
 
@@ -379,6 +399,15 @@ void ChNarrowphase::ProcessRigidRigid() {
     erad_data.resize(num_rigid_contacts);
     bids_data.resize(num_rigid_contacts);
     contact_shapeIDs.resize(num_rigid_contacts);
+
+    // Sort contacts by the IDs of the shapes in contact. The sort is stable, so that multiple contacts between the same
+    // pair of shapes are kept in the order produced by the narrowphase algorithm.
+    if (deterministic) {
+        thrust::stable_sort_by_key(
+            THRUST_PAR contact_shapeIDs.begin(), contact_shapeIDs.end(),
+            thrust::make_zip_iterator(thrust::make_tuple(norm_data.begin(), cpta_data.begin(), cptb_data.begin(),
+                                                         dpth_data.begin(), erad_data.begin(), bids_data.begin())));
+    }
 }
 
 // -----------------------------------------------------------------------------
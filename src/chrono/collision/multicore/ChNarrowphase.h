@@ -43,6 +43,10 @@ namespace chrono {
 /// rcyl     |                                              N        N
 /// trimesh  |                                                       N
 /// </pre>
+///
+/// With the PRIMS and HYBRID algorithms, sphere-sphere and box-sphere candidate pairs are by default grouped and
+/// processed in batches, several pairs at a time (in SIMD lanes, if AVX support is enabled and the collision system
+/// uses double precision).
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -108,6 +112,18 @@ class ChApi ChNarrowphase {
     /// Return the fictitious radius of curvature used for collisions with a corner or an edge.
     static real GetDefaultEdgeRadius();
 
+    /// Enable/disable batched processing of sphere-sphere and box-sphere pairs (default: true).
+    /// Only used with the PRIMS and HYBRID algorithms.
+    void EnableBatching(bool val) { batching = val; }
+
+    /// Enable/disable deterministic ordering of rigid contacts (default: false).
+    /// If enabled, rigid-rigid contacts are sorted by the IDs of the shapes in contact, so that the contact list does
+    /// not depend on the number of threads.
+    void EnableDeterministic(bool val) { deterministic = val; }
+
+    /// Width of a batch (number of candidate pairs processed simultaneously).
+    static const int batch_width = 4;
+
     static const int max_neighbors = 64;
     static const int max_rigid_neighbors = 32;
 
@@ -129,9 +145,14 @@ class ChApi ChNarrowphase {
     void ProcessRigidRigid();
     void ProcessRigidFluid();
 
+    /// Group the candidate pairs by shape-type combination, for batched processing.
+    void PreprocessBatches();
+
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
+    void DispatchBatchSphereSphere();
+    void DispatchBatchBoxSphere();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
@@ -148,6 +169,13 @@ class ChApi ChNarrowphase {
 
     Algorithm algorithm;
 
+    bool batching;                          ///< process sphere-sphere and box-sphere pairs in batches?
+    bool deterministic;                     ///< sort rigid contacts by shape IDs?
+    std::vector<char> pair_batch;           ///< batch type for each candidate pair
+    std::vector<uint> batch_sphere_sphere;  ///< candidate sphere-sphere pairs
+    std::vector<uint> batch_box_sphere;     ///< candidate box-sphere and sphere-box pairs
+    std::vector<uint> batch_other;          ///< candidate pairs processed individually
+
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
     std::vector<uint> f_bin_number_out;  //// TODO: rename to f_bin_active
@@ -0,0 +1,517 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched narrowphase collision detection for pairs of primitive shapes.
+//
+// Candidate pairs of the same shape-type combination are processed several at
+// a time, with the pair data gathered in SoA layout. If AVX is available (and
+// the collision system uses double precision), each batch is processed in the
+// lanes of a 256-bit register. Results are identical (up to roundoff) to those
+// of the corresponding functions in ChNarrowphasePRIMS.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/collision/multicore/ChNarrowphase.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
+
+#include "chrono/multicore_math/utility.h"
+
+#if defined(USE_AVX)
+    #include "chrono/multicore_math/simd_avx.h"
+#endif
+
+// Always include ChConfig.h *before* any Thrust headers!
+#include "chrono/ChConfig.h"
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace chrono {
+
+using namespace chrono::mc_utils;
+
+namespace {
+
+const int W = ChNarrowphase::batch_width;
+
+// Types of candidate pairs (see ChNarrowphase::PreprocessBatches)
+enum BatchType : char { BATCH_OTHER = 0, BATCH_SPHERE_SPHERE = 1, BATCH_BOX_SPHERE = 2 };
+
+struct IsBatchType {
+    char type;
+    IsBatchType(char t) : type(t) {}
+    bool operator()(char t) const { return t == type; }
+};
+
+// -----------------------------------------------------------------------------
+// Lane of W reals and corresponding lane mask
+
+#if defined(USE_AVX)
+
+struct Lane {
+    __m256d v;
+};
+
+struct Mask {
+    __m256d v;
+};
+
+inline Lane Load(const real* p) {
+    return {_mm256_load_pd(p)};
+}
+inline void Store(real* p, const Lane& a) {
+    _mm256_store_pd(p, a.v);
+}
+inline Lane Set(real s) {
+    return {_mm256_set1_pd(s)};
+}
+inline Lane operator+(const Lane& a, const Lane& b) {
+    return {simd::Add(a.v, b.v)};
+}
+inline Lane operator-(const Lane& a, const Lane& b) {
+    return {simd::Sub(a.v, b.v)};
+}
+inline Lane operator*(const Lane& a, const Lane& b) {
+    return {simd::Mul(a.v, b.v)};
+}
+inline Lane operator/(const Lane& a, const Lane& b) {
+    return {simd::Div(a.v, b.v)};
+}
+inline Lane Sqrt(const Lane& a) {
+    return {simd::SquareRoot(a.v)};
+}
+inline Lane Abs(const Lane& a) {
+    return {simd::Abs(a.v)};
+}
+inline Lane Min(const Lane& a, const Lane& b) {
+    return {simd::Min(a.v, b.v)};
+}
+inline Lane Max(const Lane& a, const Lane& b) {
+    return {simd::Max(a.v, b.v)};
+}
+inline Mask operator<(const Lane& a, const Lane& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};
+}
+inline Mask operator>(const Lane& a, const Lane& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)};
+}
+inline Mask operator>=(const Lane& a, const Lane& b) {
+    return {_mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ)};
+}
+inline Mask And(const Mask& a, const Mask& b) {
+    return {_mm256_and_pd(a.v, b.v)};
+}
+inline Lane Select(const Mask& m, const Lane& a, const Lane& b) {
+    return {_mm256_blendv_pd(b.v, a.v, m.v)};
+}
+inline int Bits(const Mask& m) {
+    return _mm256_movemask_pd(m.v);
+}
+
+#else
+
+struct Lane {
+    real v[W];
+};
+
+struct Mask {
+    bool v[W];
+};
+
+inline Lane Load(const real* p) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = p[k];
+    return r;
+}
+inline void Store(real* p, const Lane& a) {
+    for (int k = 0; k < W; k++)
+        p[k] = a.v[k];
+}
+inline Lane Set(real s) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = s;
+    return r;
+}
+inline Lane operator+(const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] + b.v[k];
+    return r;
+}
+inline Lane operator-(const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] - b.v[k];
+    return r;
+}
+inline Lane operator*(const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] * b.v[k];
+    return r;
+}
+inline Lane operator/(const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] / b.v[k];
+    return r;
+}
+inline Lane Sqrt(const Lane& a) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = chrono::Sqrt(a.v[k]);
+    return r;
+}
+inline Lane Abs(const Lane& a) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = chrono::Abs(a.v[k]);
+    return r;
+}
+inline Lane Min(const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = b.v[k] < a.v[k] ? b.v[k] : a.v[k];
+    return r;
+}
+inline Lane Max(const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = b.v[k] > a.v[k] ? b.v[k] : a.v[k];
+    return r;
+}
+inline Mask operator<(const Lane& a, const Lane& b) {
+    Mask r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] < b.v[k];
+    return r;
+}
+inline Mask operator>(const Lane& a, const Lane& b) {
+    Mask r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] > b.v[k];
+    return r;
+}
+inline Mask operator>=(const Lane& a, const Lane& b) {
+    Mask r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] >= b.v[k];
+    return r;
+}
+inline Mask And(const Mask& a, const Mask& b) {
+    Mask r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = a.v[k] && b.v[k];
+    return r;
+}
+inline Lane Select(const Mask& m, const Lane& a, const Lane& b) {
+    Lane r;
+    for (int k = 0; k < W; k++)
+        r.v[k] = m.v[k] ? a.v[k] : b.v[k];
+    return r;
+}
+inline int Bits(const Mask& m) {
+    int bits = 0;
+    for (int k = 0; k < W; k++)
+        bits |= (m.v[k] ? 1 : 0) << k;
+    return bits;
+}
+
+#endif
+
+// Rotate the vector v by the quaternion q (see chrono::Rotate).
+inline void Rotate(const Lane q[4], const Lane v[3], Lane r[3]) {
+    Lane two = Set(2);
+    Lane t[3] = {two * (q[2] * v[2] - q[3] * v[1]),  //
+                 two * (q[3] * v[0] - q[1] * v[2]),  //
+                 two * (q[1] * v[1] - q[2] * v[0])};
+    r[0] = v[0] + q[0] * t[0] + (q[2] * t[2] - q[3] * t[1]);
+    r[1] = v[1] + q[0] * t[1] + (q[3] * t[0] - q[1] * t[2]);
+    r[2] = v[2] + q[0] * t[2] + (q[1] * t[1] - q[2] * t[0]);
+}
+
+// Padding for unused lanes in a partial batch: far away, zero-size shapes never produce a contact.
+const real far_away = real(1e10);
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+void ChNarrowphase::PreprocessBatches() {
+    const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+
+    // Classify the candidate pairs
+    pair_batch.resize(num_potential_rigid_contacts);
+
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
+        shape_type type1 = obj_data_T[int(pair_shapeIDs[index] >> 32)];
+        shape_type type2 = obj_data_T[int(pair_shapeIDs[index] & 0xffffffff)];
+
+        if (type1 == ChCollisionShape::Type::SPHERE && type2 == ChCollisionShape::Type::SPHERE)
+            pair_batch[index] = BATCH_SPHERE_SPHERE;
+        else if ((type1 == ChCollisionShape::Type::BOX && type2 == ChCollisionShape::Type::SPHERE) ||
+                 (type1 == ChCollisionShape::Type::SPHERE && type2 == ChCollisionShape::Type::BOX))
+            pair_batch[index] = BATCH_BOX_SPHERE;
+        else
+            pair_batch[index] = BATCH_OTHER;
+    }
+
+    // Extract the lists of pair indices for each batch type
+    auto extract = [this](char type, std::vector<uint>& list) {
+        list.resize(num_potential_rigid_contacts);
+        auto end = thrust::copy_if(THRUST_PAR thrust::counting_iterator<uint>(0),
+                                   thrust::counting_iterator<uint>(num_potential_rigid_contacts), pair_batch.begin(),
+                                   list.begin(), IsBatchType(type));
+        list.resize(end - list.begin());
+    };
+
+    extract(BATCH_SPHERE_SPHERE, batch_sphere_sphere);
+    extract(BATCH_BOX_SPHERE, batch_box_sphere);
+    extract(BATCH_OTHER, batch_other);
+}
+
+// -----------------------------------------------------------------------------
+// Batched sphere-sphere collision (see sphere_sphere in ChNarrowphasePRIMS)
+
+void ChNarrowphase::DispatchBatchSphereSphere() {
+    const real separation = 2 * cd_data->collision_envelope;
+    const shape_container& shapes = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const uint* obj_data_ID = shapes.id_rigid.data();
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+    int num_pairs = (int)batch_sphere_sphere.size();
+    int num_batches = (num_pairs + W - 1) / W;
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        int count = std::min(W, num_pairs - ib * W);
+
+        // Gather pair data in SoA layout
+        alignas(32) real in[8][W];
+        for (int k = 0; k < W; k++) {
+            if (k < count) {
+                long long p = pair_shapeIDs[batch_sphere_sphere[ib * W + k]];
+                int s1 = int(p >> 32);
+                int s2 = int(p & 0xffffffff);
+                const real3& pos1 = shapes.obj_data_A_global[s1];
+                const real3& pos2 = shapes.obj_data_A_global[s2];
+                in[0][k] = pos1.x;
+                in[1][k] = pos1.y;
+                in[2][k] = pos1.z;
+                in[3][k] = shapes.sphere_rigid[shapes.start_rigid[s1]];
+                in[4][k] = pos2.x;
+                in[5][k] = pos2.y;
+                in[6][k] = pos2.z;
+                in[7][k] = shapes.sphere_rigid[shapes.start_rigid[s2]];
+            } else {
+                for (int j = 0; j < 8; j++)
+                    in[j][k] = 0;
+                in[4][k] = far_away;
+            }
+        }
+
+        Lane pos1[3] = {Load(in[0]), Load(in[1]), Load(in[2])};
+        Lane pos2[3] = {Load(in[4]), Load(in[5]), Load(in[6])};
+        Lane radius1 = Load(in[3]);
+        Lane radius2 = Load(in[7]);
+
+        Lane delta[3] = {pos2[0] - pos1[0], pos2[1] - pos1[1], pos2[2] - pos1[2]};
+        Lane dist2 = delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+        Lane radSum = radius1 + radius2;
+        Lane radSum_s = radSum + Set(separation);
+
+        // Contact if the sphere centers are not separated by more than the sum of their radii (plus the separation
+        // value) and if they do not (almost) coincide
+        int active = Bits(And(dist2 < radSum_s * radSum_s, dist2 >= Set(real(1e-12))));
+        if (active == 0)
+            continue;
+
+        Lane dist = Sqrt(dist2);
+        Lane n[3] = {delta[0] / dist, delta[1] / dist, delta[2] / dist};
+
+        alignas(32) real out[12][W];
+        for (int j = 0; j < 3; j++) {
+            Store(out[j], n[j]);
+            Store(out[3 + j], pos1[j] + n[j] * radius1);
+            Store(out[6 + j], pos2[j] - n[j] * radius2);
+        }
+        Store(out[9], dist - radSum);
+        Store(out[10], radius1 * radius2 / radSum);
+
+        // Scatter results for active contacts
+        for (int k = 0; k < count; k++) {
+            if (!((active >> k) & 1))
+                continue;
+            uint index = batch_sphere_sphere[ib * W + k];
+            long long p = pair_shapeIDs[index];
+            uint icoll = contact_index[index];
+            norm[icoll] = real3(out[0][k], out[1][k], out[2][k]);
+            ptA[icoll] = real3(out[3][k], out[4][k], out[5][k]);
+            ptB[icoll] = real3(out[6][k], out[7][k], out[8][k]);
+            contactDepth[icoll] = out[9][k];
+            effective_radius[icoll] = out[10][k];
+            Dispatch_Finalize(icoll, obj_data_ID[int(p >> 32)], obj_data_ID[int(p & 0xffffffff)], 1);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Batched box-sphere collision (see box_sphere in ChNarrowphasePRIMS)
+
+void ChNarrowphase::DispatchBatchBoxSphere() {
+    const real separation = 2 * cd_data->collision_envelope;
+    const real edge_radius = GetDefaultEdgeRadius();
+    const shape_container& shapes = cd_data->shape_data;
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const uint* obj_data_ID = shapes.id_rigid.data();
+
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+    int num_pairs = (int)batch_box_sphere.size();
+    int num_batches = (num_pairs + W - 1) / W;
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        int count = std::min(W, num_pairs - ib * W);
+
+        // Gather pair data in SoA layout (box first, sphere second)
+        alignas(32) real in[14][W];
+        bool swap[W];
+        for (int k = 0; k < W; k++) {
+            if (k < count) {
+                long long p = pair_shapeIDs[batch_box_sphere[ib * W + k]];
+                int s1 = int(p >> 32);
+                int s2 = int(p & 0xffffffff);
+                swap[k] = (shapes.typ_rigid[s1] != ChCollisionShape::Type::BOX);
+                if (swap[k])
+                    std::swap(s1, s2);
+                const real3& pos1 = shapes.obj_data_A_global[s1];
+                const quaternion& rot1 = shapes.obj_data_R_global[s1];
+                const real3& hdims1 = shapes.box_like_rigid[shapes.start_rigid[s1]];
+                const real3& pos2 = shapes.obj_data_A_global[s2];
+                in[0][k] = pos1.x;
+                in[1][k] = pos1.y;
+                in[2][k] = pos1.z;
+                in[3][k] = rot1.w;
+                in[4][k] = rot1.x;
+                in[5][k] = rot1.y;
+                in[6][k] = rot1.z;
+                in[7][k] = hdims1.x;
+                in[8][k] = hdims1.y;
+                in[9][k] = hdims1.z;
+                in[10][k] = pos2.x;
+                in[11][k] = pos2.y;
+                in[12][k] = pos2.z;
+                in[13][k] = shapes.sphere_rigid[shapes.start_rigid[s2]];
+            } else {
+                swap[k] = false;
+                for (int j = 0; j < 14; j++)
+                    in[j][k] = 0;
+                in[3][k] = 1;
+                in[10][k] = far_away;
+            }
+        }
+
+        Lane pos1[3] = {Load(in[0]), Load(in[1]), Load(in[2])};
+        Lane rot1[4] = {Load(in[3]), Load(in[4]), Load(in[5]), Load(in[6])};
+        Lane hdims1[3] = {Load(in[7]), Load(in[8]), Load(in[9])};
+        Lane pos2[3] = {Load(in[10]), Load(in[11]), Load(in[12])};
+        Lane radius2 = Load(in[13]);
+        Lane zero = Set(0);
+        Lane one = Set(1);
+
+        // Express the sphere position in the frame of the box
+        Lane rot1_c[4] = {rot1[0], zero - rot1[1], zero - rot1[2], zero - rot1[3]};
+        Lane rel[3] = {pos2[0] - pos1[0], pos2[1] - pos1[1], pos2[2] - pos1[2]};
+        Lane spherePos[3];
+        Rotate(rot1_c, rel, spherePos);
+
+        // Snap the sphere position to the surface of the box and count the number of clamped directions
+        Lane boxPos[3];
+        Lane num_clamped = zero;
+        for (int j = 0; j < 3; j++) {
+            boxPos[j] = Min(Max(spherePos[j], zero - hdims1[j]), hdims1[j]);
+            num_clamped = num_clamped + Select(Abs(spherePos[j]) > hdims1[j], one, zero);
+        }
+
+        Lane delta[3] = {spherePos[0] - boxPos[0], spherePos[1] - boxPos[1], spherePos[2] - boxPos[2]};
+        Lane dist2 = delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+        Lane radius2_s = radius2 + Set(separation);
+
+        // Contact if the distance from the sphere center to the closest point on the box is not larger than the
+        // sphere radius plus the separation value and if the sphere center does not (almost) coincide with that point
+        int active = Bits(And(dist2 < radius2_s * radius2_s, Set(real(1e-12f)) < dist2));
+        if (active == 0)
+            continue;
+
+        Lane dist = Sqrt(dist2);
+        Lane n_loc[3] = {delta[0] / dist, delta[1] / dist, delta[2] / dist};
+        Lane n[3];
+        Rotate(rot1, n_loc, n);
+        Lane pt1[3];
+        Rotate(rot1, boxPos, pt1);
+
+        // Use the fictitious edge radius, unless the contact is on a face of the box (a single clamped direction)
+        Lane eff_radius_edge = radius2 * Set(edge_radius) / (radius2 + Set(edge_radius));
+        Lane eff_radius = Select(And(Set(0.5) < num_clamped, num_clamped < Set(1.5)), radius2, eff_radius_edge);
+
+        alignas(32) real out[12][W];
+        for (int j = 0; j < 3; j++) {
+            Store(out[j], n[j]);
+            Store(out[3 + j], pos1[j] + pt1[j]);
+            Store(out[6 + j], pos2[j] - n[j] * radius2);
+        }
+        Store(out[9], dist - radius2);
+        Store(out[10], eff_radius);
+
+        // Scatter results for active contacts (flip the contact if the sphere is the first shape in the pair)
+        for (int k = 0; k < count; k++) {
+            if (!((active >> k) & 1))
+                continue;
+            uint index = batch_box_sphere[ib * W + k];
+            long long p = pair_shapeIDs[index];
+            uint icoll = contact_index[index];
+            real3 n_k(out[0][k], out[1][k], out[2][k]);
+            real3 pt1_k(out[3][k], out[4][k], out[5][k]);
+            real3 pt2_k(out[6][k], out[7][k], out[8][k]);
+            if (swap[k]) {
+                norm[icoll] = -n_k;
+                ptA[icoll] = pt2_k;
+                ptB[icoll] = pt1_k;
+            } else {
+                norm[icoll] = n_k;
+                ptA[icoll] = pt1_k;
+                ptB[icoll] = pt2_k;
+            }
+            contactDepth[icoll] = out[9][k];
+            effective_radius[icoll] = out[10][k];
+            Dispatch_Finalize(icoll, obj_data_ID[int(p >> 32)], obj_data_ID[int(p & 0xffffffff)], 1);
+        }
+    }
+}
+
+}  // end namespace chrono
@@ -95,6 +95,15 @@ void ArchiveOut(chrono::ChArchiveOut& archive_out) {
         size_t tot_elements = derived().rows() * derived().cols();
         double* foo = 0;
         chrono::ChValueSpecific<double*> specVal(foo, "data", 0);
+
+        // contiguous storage: output the matrix data as a single block
+        if constexpr ((Flags & DirectAccessBit) != 0 && std::is_arithmetic<Scalar>::value) {
+            if (derived().innerStride() == 1 && derived().outerStride() == derived().innerSize()) {
+                archive_out.out_array(specVal, derived().data(), tot_elements);
+                return;
+            }
+        }
+
         archive_out.out_array_pre(specVal, tot_elements);
         for (size_t i = 0; i < tot_elements; i++) {
             archive_out << chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
@@ -121,6 +130,15 @@ void ArchiveIn(chrono::ChArchiveIn& archive_in) {
     // custom input of matrix data as array
     size_t tot_elements = derived().rows() * derived().cols();
     archive_in.in_array_pre("data", tot_elements);
+
+    // contiguous storage: input the matrix data as a single block
+    if constexpr ((Flags & DirectAccessBit) != 0 && std::is_arithmetic<Scalar>::value) {
+        if (derived().innerStride() == 1 && derived().outerStride() == derived().innerSize()) {
+            archive_in.in_array("data", derived().data(), tot_elements);
+            return;
+        }
+    }
+
     for (size_t i = 0; i < tot_elements; i++) {
         archive_in >> chrono::CHNVP(derived()((Eigen::Index)i), std::to_string(i).c_str());
         archive_in.in_array_between("data");
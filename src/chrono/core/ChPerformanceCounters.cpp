@@ -0,0 +1,216 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+#include "chrono/core/ChPerformanceCounters.h"
+
+namespace chrono {
+
+ChPerformanceCounters::ChPerformanceCounters()
+    : m_capacity(1000), m_head(0), m_size(0), m_stream_format(Format::CSV) {}
+
+ChPerformanceCounters::~ChPerformanceCounters() {
+    StopStream();
+}
+
+int ChPerformanceCounters::Register(const std::string& name, Provider provider) {
+    return AddCounter(name, provider);
+}
+
+int ChPerformanceCounters::Register(const std::string& name) {
+    return AddCounter(name, nullptr);
+}
+
+int ChPerformanceCounters::AddCounter(const std::string& name, Provider provider) {
+    int id = GetIndex(name);
+    if (id >= 0) {
+        m_counters[id].provider = provider;
+        m_counters[id].value = 0;
+        return id;
+    }
+
+    // The set of columns in the output stream cannot be changed
+    if (m_stream.is_open())
+        throw std::runtime_error("ChPerformanceCounters: cannot register counter '" + name + "' while streaming.");
+
+    m_counters.push_back({name, provider, 0});
+    ClearHistory();
+
+    return (int)m_counters.size() - 1;
+}
+
+int ChPerformanceCounters::GetIndex(const std::string& name) const {
+    for (size_t i = 0; i < m_counters.size(); i++) {
+        if (m_counters[i].name == name)
+            return (int)i;
+    }
+    return -1;
+}
+
+void ChPerformanceCounters::SetHistoryLength(size_t length) {
+    m_capacity = std::max(length, size_t(1));
+    ClearHistory();
+}
+
+void ChPerformanceCounters::ClearHistory() {
+    m_history.clear();
+    m_head = 0;
+    m_size = 0;
+}
+
+void ChPerformanceCounters::Sample(double time) {
+    size_t row_size = 1 + m_counters.size();
+    if (m_history.empty())
+        m_history.resize(m_capacity * row_size);
+
+    // Overwrite the oldest sample if the ring buffer is full
+    size_t sample = m_size;
+    if (m_size == m_capacity) {
+        m_head = (m_head + 1) % m_capacity;
+        sample = m_size - 1;
+    } else {
+        m_size++;
+    }
+
+    double* row = &m_history[Row(sample)];
+    row[0] = time;
+    for (size_t i = 0; i < m_counters.size(); i++) {
+        auto& counter = m_counters[i];
+        if (counter.provider) {
+            row[1 + i] = counter.provider();
+        } else {
+            row[1 + i] = counter.value;
+            counter.value = 0;
+        }
+    }
+
+    if (m_stream.is_open())
+        WriteSample(m_stream, m_stream_format, sample);
+}
+
+double ChPerformanceCounters::GetMin(int id) const {
+    double val = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < m_size; i++)
+        val = std::min(val, GetValue(id, i));
+    return m_size > 0 ? val : 0;
+}
+
+double ChPerformanceCounters::GetMax(int id) const {
+    double val = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < m_size; i++)
+        val = std::max(val, GetValue(id, i));
+    return m_size > 0 ? val : 0;
+}
+
+double ChPerformanceCounters::GetMean(int id) const {
+    double val = 0;
+    for (size_t i = 0; i < m_size; i++)
+        val += GetValue(id, i);
+    return m_size > 0 ? val / m_size : 0;
+}
+
+// Write a counter name as a JSON string.
+static void WriteJSONString(std::ostream& out, const std::string& name) {
+    out << '"';
+    for (char c : name) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            default:
+                if ((unsigned char)c < 0x20)
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec
+                        << std::setfill(' ');
+                else
+                    out << c;
+        }
+    }
+    out << '"';
+}
+
+void ChPerformanceCounters::WriteHeader(std::ostream& out, Format format) const {
+    if (format != Format::CSV)
+        return;
+    out << "time";
+    for (const auto& counter : m_counters)
+        out << "," << counter.name;
+    out << "\n";
+}
+
+void ChPerformanceCounters::WriteSample(std::ostream& out, Format format, size_t sample) const {
+    switch (format) {
+        case Format::CSV:
+            out << GetTime(sample);
+            for (int i = 0; i < GetNumCounters(); i++)
+                out << "," << GetValue(i, sample);
+            out << "\n";
+            break;
+        case Format::JSON:
+            out << "{\"time\":" << GetTime(sample);
+            for (int i = 0; i < GetNumCounters(); i++) {
+                out << ",";
+                WriteJSONString(out, m_counters[i].name);
+                out << ":" << GetValue(i, sample);
+            }
+            out << "}\n";
+            break;
+    }
+}
+
+bool ChPerformanceCounters::Write(const std::string& filename, Format format) const {
+    std::ofstream out(filename);
+    if (!out.is_open())
+        return false;
+
+    out << std::setprecision(10);
+    WriteHeader(out, format);
+    for (size_t i = 0; i < m_size; i++)
+        WriteSample(out, format, i);
+
+    return out.good();
+}
+
+bool ChPerformanceCounters::StartStream(const std::string& filename, Format format) {
+    StopStream();
+    m_stream.open(filename);
+    if (!m_stream.is_open())
+        return false;
+
+    m_stream_format = format;
+    m_stream << std::setprecision(10);
+    WriteHeader(m_stream, format);
+
+    return true;
+}
+
+void ChPerformanceCounters::StopStream() {
+    if (m_stream.is_open())
+        m_stream.close();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_PERFORMANCE_COUNTERS_H
+#define CH_PERFORMANCE_COUNTERS_H
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_core
+/// @{
+
+/// Registry of named performance counters, sampled once per simulation step.
+/// A counter is either evaluated through a provider function at each call to Sample() (e.g., a timer or the number
+/// of contacts), or is an accumulator whose value is set with Set() or incremented with Add() during a step and reset
+/// to zero after each sample (e.g., number of allocations). Samples are kept in a ring buffer holding the most recent
+/// steps and can optionally be streamed to a CSV or JSON-lines file as they are recorded.
+class ChApi ChPerformanceCounters {
+  public:
+    /// Export file format.
+    enum class Format {
+        CSV,  ///< comma-separated values, with a header line listing the counter names
+        JSON  ///< one JSON object per sample (JSON lines)
+    };
+
+    /// Function returning the current value of a counter.
+    typedef std::function<double()> Provider;
+
+    ChPerformanceCounters();
+    ~ChPerformanceCounters();
+
+    /// Register a counter evaluated through the given provider at each sample.
+    /// If a counter with the same name exists, it is replaced. Returns the counter index.
+    /// Registering a new counter clears the sample history. New counters cannot be registered while streaming samples
+    /// to a file (an exception is thrown).
+    int Register(const std::string& name, Provider provider);
+
+    /// Register an accumulator counter, set with Set() or Add() and reset to zero after each sample.
+    /// If a counter with the same name exists, it is replaced. Returns the counter index.
+    /// Registering a new counter clears the sample history. New counters cannot be registered while streaming samples
+    /// to a file (an exception is thrown).
+    int Register(const std::string& name);
+
+    /// Return the index of the counter with given name (-1 if not registered).
+    int GetIndex(const std::string& name) const;
+
+    /// Return the number of registered counters.
+    int GetNumCounters() const { return (int)m_counters.size(); }
+
+    /// Return the name of the specified counter.
+    const std::string& GetName(int id) const { return m_counters[id].name; }
+
+    /// Set the value of an accumulator counter for the current step.
+    void Set(int id, double value) { m_counters[id].value = value; }
+
+    /// Increment the value of an accumulator counter for the current step.
+    void Add(int id, double value) { m_counters[id].value += value; }
+
+    /// Set the maximum number of samples kept in history (default: 1000).
+    /// Changing the history length clears the sample history.
+    void SetHistoryLength(size_t length);
+
+    /// Return the maximum number of samples kept in history.
+    size_t GetHistoryLength() const { return m_capacity; }
+
+    /// Record a sample of all counters at the given time.
+    /// Provider counters are evaluated, accumulator counters are recorded and then reset to zero.
+    void Sample(double time);
+
+    /// Return the number of samples currently in history (at most the history length).
+    size_t GetNumSamples() const { return m_size; }
+
+    /// Return the time of the specified sample in history (0 is the oldest sample).
+    double GetTime(size_t sample) const { return m_history[Row(sample)]; }
+
+    /// Return the value of a counter for the specified sample in history (0 is the oldest sample).
+    double GetValue(int id, size_t sample) const { return m_history[Row(sample) + 1 + id]; }
+
+    /// Return the value of a counter at the most recent sample (0 if there are no samples in history).
+    double GetLastValue(int id) const { return m_size > 0 ? GetValue(id, m_size - 1) : 0; }
+
+    /// Return the minimum value of a counter over the samples in history.
+    double GetMin(int id) const;
+
+    /// Return the maximum value of a counter over the samples in history.
+    double GetMax(int id) const;
+
+    /// Return the average value of a counter over the samples in history.
+    double GetMean(int id) const;
+
+    /// Discard all samples in history.
+    void ClearHistory();
+
+    /// Write all samples in history to the specified file.
+    bool Write(const std::string& filename, Format format = Format::CSV) const;
+
+    /// Stream all subsequent samples to the specified file, as they are recorded.
+    /// All counters must be registered before streaming is started.
+    bool StartStream(const std::string& filename, Format format = Format::CSV);
+
+    /// Stop streaming samples and close the output file.
+    void StopStream();
+
+  private:
+    struct Counter {
+        std::string name;
+        Provider provider;
+        double value;
+    };
+
+    size_t Row(size_t sample) const { return ((m_head + sample) % m_capacity) * (1 + m_counters.size()); }
+    int AddCounter(const std::string& name, Provider provider);
+    void WriteHeader(std::ostream& out, Format format) const;
+    void WriteSample(std::ostream& out, Format format, size_t sample) const;
+
+    std::vector<Counter> m_counters;  ///< registered counters
+    std::vector<double> m_history;    ///< ring buffer of samples (time and counter values)
+    size_t m_capacity;                ///< maximum number of samples in history
+    size_t m_head;                    ///< location of the oldest sample in history
+    size_t m_size;                    ///< number of samples in history
+
+    std::ofstream m_stream;  ///< output stream (if streaming)
+    Format m_stream_format;  ///< format of the output stream
+};
+
+/// @} chrono_core
+
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/core/ChSparsityPatternLearner.h"
+
+namespace chrono {
+
+// Initial value of the per-inner vector keys (64-bit FNV-1a offset basis)
+static const uint64_t KEY_BASIS = 14695981039346656037ULL;
+
+// -----------------------------------------------------------------------------
+
+void ChSparsityPattern::Clear() {
+    m_rows = 0;
+    m_cols = 0;
+    m_outer.clear();
+    m_inner.clear();
+    m_keys.clear();
+    m_num_updated = 0;
+}
+
+void ChSparsityPattern::Apply(ChSparseMatrix& mat) const {
+    mat.resize(m_rows, m_cols);
+    if (m_outer.empty())
+        return;
+
+    mat.resizeNonZeros((ChSparseMatrix::Index)m_inner.size());
+    std::copy(m_outer.begin(), m_outer.end(), mat.outerIndexPtr());
+    std::copy(m_inner.begin(), m_inner.end(), mat.innerIndexPtr());
+    std::fill(mat.valuePtr(), mat.valuePtr() + m_inner.size(), 0.0);
+}
+
+bool ChSparsityPattern::Matches(const ChSparseMatrix& mat) const {
+    if (!mat.isCompressed() || mat.rows() != m_rows || mat.cols() != m_cols || m_outer.empty() ||
+        mat.nonZeros() != (ChSparseMatrix::Index)m_inner.size())
+        return false;
+
+    return std::equal(m_outer.begin(), m_outer.end(), mat.outerIndexPtr()) &&
+           std::equal(m_inner.begin(), m_inner.end(), mat.innerIndexPtr());
+}
+
+// -----------------------------------------------------------------------------
+
+ChSparsityPatternLearner::ChSparsityPatternLearner(int nrows, int ncols)
+    : ChSparseMatrix(nrows, ncols), processed(false) {
+    // RowMajor: outerSize == nrows
+    // ColMajor: outerSize == ncols
+    m_keys.assign(outerSize(), KEY_BASIS);
+}
+
+bool ChSparsityPatternLearner::Learn(ChSparsityPattern& pattern) {
+    const int n_outer = (int)outerSize();
+    const int n_inner = (int)innerSize();
+
+    // The cached pattern can be used only if it has the same dimensions
+    bool use_cache = pattern.m_rows == (int)rows() && pattern.m_cols == (int)cols() &&
+                     (int)pattern.m_keys.size() == n_outer && (int)pattern.m_outer.size() == n_outer + 1;
+
+    // Flag the inner vectors that must be processed (those with a different insertion sequence)
+    std::vector<char> update(n_outer, 1);
+    int num_updated = n_outer;
+    if (use_cache) {
+        num_updated = 0;
+        for (int i = 0; i < n_outer; i++) {
+            update[i] = (pattern.m_keys[i] != m_keys[i]);
+            num_updated += update[i];
+        }
+    }
+
+    pattern.m_num_updated = num_updated;
+    if (use_cache && num_updated == 0)
+        return true;
+
+    // First pass: count insertions in each updated inner vector
+    std::vector<int> start(n_outer + 1, 0);
+    for (auto outer : m_entries_outer) {
+        if (update[outer])
+            start[outer + 1]++;
+    }
+    for (int i = 0; i < n_outer; i++)
+        start[i + 1] += start[i];
+
+    // Second pass: bucket the inner indices of updated inner vectors
+    std::vector<int> bucket(start[n_outer]);
+    std::vector<int> next(start.begin(), start.end() - 1);
+    for (size_t k = 0; k < m_entries_outer.size(); k++) {
+        int outer = m_entries_outer[k];
+        if (update[outer])
+            bucket[next[outer]++] = m_entries_inner[k];
+    }
+
+    // Assemble the new pattern, removing duplicates and sorting the updated inner vectors,
+    // and copying the unchanged ones from the cached pattern
+    std::vector<int> outer_indices(n_outer + 1);
+    std::vector<int> inner_indices;
+    inner_indices.reserve(use_cache ? pattern.m_inner.size() + bucket.size() : bucket.size());
+    std::vector<int> stamp(n_inner, -1);
+
+    for (int i = 0; i < n_outer; i++) {
+        outer_indices[i] = (int)inner_indices.size();
+        if (update[i]) {
+            for (int k = start[i]; k < start[i + 1]; k++) {
+                int inner = bucket[k];
+                if (stamp[inner] != i) {
+                    stamp[inner] = i;
+                    inner_indices.push_back(inner);
+                }
+            }
+            std::sort(inner_indices.begin() + outer_indices[i], inner_indices.end());
+        } else {
+            inner_indices.insert(inner_indices.end(), pattern.m_inner.begin() + pattern.m_outer[i],
+                                 pattern.m_inner.begin() + pattern.m_outer[i + 1]);
+        }
+    }
+    outer_indices[n_outer] = (int)inner_indices.size();
+
+    bool unchanged = use_cache && outer_indices == pattern.m_outer && inner_indices == pattern.m_inner;
+
+    pattern.m_rows = (int)rows();
+    pattern.m_cols = (int)cols();
+    pattern.m_outer.swap(outer_indices);
+    pattern.m_inner.swap(inner_indices);
+    pattern.m_keys = m_keys;
+
+    return unchanged;
+}
+
+void ChSparsityPatternLearner::Apply(ChSparseMatrix& mat) {
+    if (!processed) {
+        Learn(m_pattern);
+        processed = true;
+    }
+
+    m_pattern.Apply(mat);
+}
+
+}  // end namespace chrono
@@ -15,6 +15,10 @@
 #ifndef CHSPARSITYPATTERNLEARNER_H
 #define CHSPARSITYPATTERNLEARNER_H
 
+#include <cstdint>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
@@ -22,68 +26,91 @@ namespace chrono {
 /// @addtogroup chrono_linalg
 /// @{
 
+/// Compressed sparsity pattern, as extracted by a ChSparsityPatternLearner.
+/// Besides the compressed index arrays, the pattern stores, for each inner vector (each row if RowMajor), a key which
+/// identifies the sequence of insertions that produced it. A pattern can therefore be passed to subsequent learning
+/// passes as a cache: inner vectors with unchanged keys are copied from the cached pattern instead of being processed
+/// again, so that small topology changes (e.g., a few added or removed contacts) only update the affected rows.
+class ChApi ChSparsityPattern {
+  public:
+    ChSparsityPattern() : m_rows(0), m_cols(0), m_num_updated(0) {}
+
+    /// Clear the pattern (and therefore the cached data for the next learning pass).
+    void Clear();
+
+    /// Get the number of rows of the pattern.
+    int GetNumRows() const { return m_rows; }
+
+    /// Get the number of columns of the pattern.
+    int GetNumCols() const { return m_cols; }
+
+    /// Get the number of non-zero elements in the pattern.
+    int GetNumNonZeros() const { return (int)m_inner.size(); }
+
+    /// Get the number of inner vectors that were (re)processed during the last learning pass.
+    /// Inner vectors with unchanged keys are reused from the previous pattern.
+    int GetNumUpdatedInnerVectors() const { return m_num_updated; }
+
+    /// Get the outer index array (size: outer size + 1).
+    const std::vector<int>& GetOuterIndices() const { return m_outer; }
+
+    /// Get the inner index array (size: number of non-zeros), sorted within each inner vector.
+    const std::vector<int>& GetInnerIndices() const { return m_inner; }
+
+    /// Resize the given matrix and set its structure to this sparsity pattern.
+    /// On return, the matrix is in compressed mode and all its elements are explicitly set to zero.
+    void Apply(ChSparseMatrix& mat) const;
+
+    /// Check whether the given matrix is compressed and has exactly this sparsity pattern.
+    bool Matches(const ChSparseMatrix& mat) const;
+
+  private:
+    int m_rows;
+    int m_cols;
+    std::vector<int> m_outer;      ///< start of each inner vector in the inner index array
+    std::vector<int> m_inner;      ///< sorted inner indices of the non-zero elements
+    std::vector<uint64_t> m_keys;  ///< keys of the insertion sequences, one per inner vector
+    int m_num_updated;             ///< number of inner vectors processed in the last learning pass
+
+    friend class ChSparsityPatternLearner;
+};
+
 /// Utility class for extracting sparsity patter from a sparse matrix.
 /// Derived from ChSparseMatrix, ChSparsityPatternLearner does not allocate values, but only element indices.
+/// Insertions are recorded in flat arrays and the pattern is then extracted with a counting sort over the inner
+/// vectors (rows if RowMajor), followed by the removal of duplicates and a sort within each inner vector.
 /// The sparsity pattern can then be applied to a given sparse matrix.
-class ChSparsityPatternLearner : public Eigen::SparseMatrix<double, Eigen::RowMajor, int> {
+class ChApi ChSparsityPatternLearner : public Eigen::SparseMatrix<double, Eigen::RowMajor, int> {
   public:
-    ChSparsityPatternLearner(int nrows, int ncols) : ChSparseMatrix(nrows, ncols), processed(false) {
-        // RowMajor: outerSize == nrows
-        // ColMajor: outerSize == ncols
-        innerVectors.resize(outerSize());
-    }
+    ChSparsityPatternLearner(int nrows, int ncols);
 
     ~ChSparsityPatternLearner() {}
 
     virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
         const Index outer = IsRowMajor ? row : col;
         const Index inner = IsRowMajor ? col : row;
-        innerVectors[outer].push_back((int)inner);
+        m_entries_outer.push_back((int)outer);
+        m_entries_inner.push_back((int)inner);
+        m_keys[outer] = (m_keys[outer] ^ (uint64_t)inner) * 1099511628211ULL;
+        processed = false;
     }
 
-    void Apply(ChSparseMatrix& mat) {
-        if (!processed)
-            process();
-
-        // Resize the matrix and reserve space for non-zero elements in each inner vector
-        mat.resize(rows(), cols());
-        mat.reserve(innerVectors_size);
-
-        int col_el = 0;
-        for (auto outer = 0; outer < innerVectors.size(); ++outer) {
-            for (auto inner = innerVectors[outer].begin(); inner != innerVectors[outer].end(); ++inner) {
-                mat.innerIndexPtr()[col_el] = *inner;
-                col_el++;
-            }
-        }
-    }
+    /// Extract the learned sparsity pattern.
+    /// The data already present in 'pattern' (from a previous learning pass) is used as a cache: inner vectors with
+    /// the same sequence of insertions are not processed again. Return true if the extracted pattern is identical to
+    /// the one provided on input.
+    bool Learn(ChSparsityPattern& pattern);
 
-  private:
-    void process() {
-        // Find the unique indices of non-zero elements in each inner vector
-        for (auto vec = innerVectors.begin(); vec != innerVectors.end(); ++vec) {
-            vec->sort();
-            vec->unique();
-        }
-
-        // Cache the number of non-zero elements in each inner vector
-        // (in each row if RowMajor, in each column if ColMajor)
-        innerVectors_size.resize(innerVectors.size());
-        for (auto i = 0; i < innerVectors.size(); ++i) {
-            innerVectors_size[i] = static_cast<int>(innerVectors[i].size());
-        }
-
-        processed = true;
-    }
+    /// Apply the learned sparsity pattern to the given matrix.
+    /// On return, the matrix is in compressed mode and all its elements are explicitly set to zero.
+    void Apply(ChSparseMatrix& mat);
 
-    // RowMajor:  innerVectors[i] contains the column indices of non-zero elements in row i
-    // ColMajor:  innerVectors[i] contains the row indices of non-zero elements in column i
-    std::vector<std::list<int>> innerVectors;
-
-    // RowMajor: innerVectors_size[i] contains the number of non-zero elements in row i
-    // ColMajor: innerVectors_size[i] contains the number of non-zero elements in column i
-    std::vector<int> innerVectors_size;
+  private:
+    std::vector<int> m_entries_outer;  ///< outer index of each recorded insertion
+    std::vector<int> m_entries_inner;  ///< inner index of each recorded insertion
+    std::vector<uint64_t> m_keys;      ///< running keys of the insertion sequence, one per inner vector
 
+    ChSparsityPattern m_pattern;  ///< pattern extracted for Apply
     bool processed;
 };
 
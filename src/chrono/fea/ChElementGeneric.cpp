@@ -24,17 +24,14 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
     ComputeInternalForces(Fi);
     Fi *= c;
 
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// Attention: this is called from within a parallel OMP for loop over elements of the same color (see ChMesh).
+    //// Such elements do not share nodes, so no synchronization is needed when updating the global vector R.
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
-        if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fi(stride + j);
-        }
+        if (!GetNode(in)->IsFixed())
+            R.segment(GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += Fi.segment(stride, node_dofs);
         stride += GetNodeNumCoordsPosLevel(in);
     }
     // std::cout << "EleIntLoadResidual_F , R=" << R << std::endl;
@@ -88,17 +85,14 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
     ComputeGravityForces(Fg, G_acc);
     Fg *= c;
 
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// Attention: this is called from within a parallel OMP for loop over elements of the same color (see ChMesh).
+    //// Such elements do not share nodes, so no synchronization is needed when updating the global vector R.
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
-        if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fg(stride + j);
-        }
+        if (!GetNode(in)->IsFixed())
+            R.segment(GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += Fg.segment(stride, node_dofs);
         stride += GetNodeNumCoordsPosLevel(in);
     }
 }
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
@@ -47,6 +48,8 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    element_colors_valid = false;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +70,8 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    ColorElements();
 }
 
 void ChMesh::Relax() {
@@ -96,6 +101,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     velements.push_back(elem);
+    element_colors_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -106,6 +112,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 
 void ChMesh::ClearElements() {
     velements.clear();
+    element_colors_valid = false;
     vcontactsurfaces.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
@@ -116,6 +123,7 @@ void ChMesh::ClearElements() {
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    element_colors_valid = false;
     vnodes.clear();
     vcontactsurfaces.clear();
 
@@ -125,6 +133,59 @@ void ChMesh::ClearNodes() {
     }
 }
 
+unsigned int ChMesh::GetNumElementColors() {
+    if (!element_colors_valid)
+        ColorElements();
+    return (unsigned int)element_color_start.size() - 1;
+}
+
+// Greedy coloring of the element-node graph: each element receives the first color not already used by any of the
+// elements sharing one of its nodes. Fixed nodes are also considered, as their status may change without a new call
+// to this function. Within each color, elements are kept in their original order.
+void ChMesh::ColorElements() {
+    const unsigned int num_elements = (unsigned int)velements.size();
+
+    std::unordered_map<ChNodeFEAbase*, std::vector<unsigned int>> node_colors;
+    std::vector<unsigned int> element_color(num_elements);
+    std::vector<unsigned int> mark;  // mark[c] = ie + 1 if color c is used by a neighbor of element ie
+    unsigned int num_colors = 0;
+
+    for (unsigned int ie = 0; ie < num_elements; ie++) {
+        const auto& element = velements[ie];
+        unsigned int num_nodes = element->GetNumNodes();
+
+        for (unsigned int in = 0; in < num_nodes; in++) {
+            for (auto c : node_colors[element->GetNode(in).get()])
+                mark[c] = ie + 1;
+        }
+
+        unsigned int color = 0;
+        while (color < num_colors && mark[color] == ie + 1)
+            color++;
+        if (color == num_colors) {
+            num_colors++;
+            mark.push_back(0);
+        }
+
+        for (unsigned int in = 0; in < num_nodes; in++)
+            node_colors[element->GetNode(in).get()].push_back(color);
+        element_color[ie] = color;
+    }
+
+    element_color_start.assign(num_colors + 1, 0);
+    for (auto color : element_color)
+        element_color_start[color + 1]++;
+    for (unsigned int c = 0; c < num_colors; c++)
+        element_color_start[c + 1] += element_color_start[c];
+
+    element_color_list.resize(num_elements);
+    std::vector<unsigned int> next(element_color_start.begin(), element_color_start.end() - 1);
+    for (unsigned int ie = 0; ie < num_elements; ie++)
+        element_color_list[next[element_color[ie]]++] = ie;
+
+    element_colors_valid = true;
+}
+
 void ChMesh::AddContactSurface(std::shared_ptr<ChContactSurface> m_surf) {
     m_surf->SetPhysicsItem(this);
     vcontactsurfaces.push_back(m_surf);
@@ -290,22 +351,50 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    // Elements with the same color do not share nodes and can therefore load their contributions in R in parallel
+    // without synchronization. Colors are processed in sequence.
+    // In deterministic mode, the colored order is used even when running single-threaded, so that the nodal forces
+    // are accumulated in the same order regardless of the number of threads.
+    bool colored = nthreads > 1 || GetSystem()->IsDeterministic();
+    if (colored && !element_colors_valid)
+        ColorElements();
+    const int num_colors = colored ? (int)element_color_start.size() - 1 : 0;
+
     // elements internal forces
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+    if (colored) {
+        for (int color = 0; color < num_colors; color++) {
+            int start = (int)element_color_start[color];
+            int end = (int)element_color_start[color + 1];
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+            for (int i = start; i < end; i++) {
+                velements[element_color_list[i]]->EleIntLoadResidual_F(R, c);
+            }
+        }
+    } else {
+        for (unsigned int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+        if (colored) {
+            for (int color = 0; color < num_colors; color++) {
+                int start = (int)element_color_start[color];
+                int end = (int)element_color_start[color + 1];
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
+                for (int i = start; i < end; i++) {
+                    velements[element_color_list[i]]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+                }
+            }
+        } else {
+            for (unsigned int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+            }
         }
     }
 
@@ -44,7 +44,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          element_colors_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -104,6 +105,11 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Get the number of element colors.
+    /// Elements are partitioned in colors such that elements with the same color do not share any node. This allows
+    /// loading element contributions to global vectors in parallel, without synchronization.
+    unsigned int GetNumElementColors();
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -293,6 +299,13 @@ class ChApi ChMesh : public ChIndexedNodes {
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
 
+    /// Partition the elements in colors such that elements with the same color do not share any node.
+    void ColorElements();
+
+    std::vector<unsigned int> element_color_list;   ///< element indices, sorted by color
+    std::vector<unsigned int> element_color_start;  ///< start of each color in element_color_list (plus end)
+    bool element_colors_valid;                      ///< true if the element coloring is up to date
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
@@ -40,7 +40,8 @@ ChAssembly::ChAssembly()
       m_num_coords_vel(0),
       m_num_constr(0),
       m_num_constr_bil(0),
-      m_num_constr_uni(0) {}
+      m_num_constr_uni(0),
+      m_multithreaded(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_bodies_active = other.m_num_bodies_active;
@@ -57,6 +58,7 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_constr = other.m_num_constr;
     m_num_constr_bil = other.m_num_constr_bil;
     m_num_constr_uni = other.m_num_constr_uni;
+    m_multithreaded = other.m_multithreaded;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -94,6 +96,7 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.m_num_constr, second.m_num_constr);
     swap(first.m_num_constr_bil, second.m_num_constr_bil);
     swap(first.m_num_constr_uni, second.m_num_constr_uni);
+    swap(first.m_multithreaded, second.m_multithreaded);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -499,6 +502,12 @@ void ChAssembly::SyncCollisionModels() {
 // -----------------------------------------------------------------------------
 // UPDATING ROUTINES
 
+int ChAssembly::GetNumThreadsItems() const {
+    if (!m_multithreaded || !system)
+        return 1;
+    return (int)system->GetNumThreadsChrono();
+}
+
 void ChAssembly::SetupInitial() {
     for (auto& body : bodylist) {
         body->SetupInitial();
@@ -648,12 +657,18 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
-        body->Update(ChTime, update_assets);
+    // Bodies and shafts can be updated concurrently (if enabled); see EnableMultithreading for the requirements.
+    // Links may share mutable data (functions, markers, inner shafts) and, like meshes and other physics items,
+    // are always processed sequentially.
+    int nthreads = GetNumThreadsItems();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        bodylist[ib]->Update(ChTime, update_assets);
     }
-    for (auto& shaft : shaftlist) {
-        shaft->Update(ChTime, update_assets);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        shaftlist[is]->Update(ChTime, update_assets);
     }
     for (auto& mesh : meshlist) {
         mesh->Update(ChTime, update_assets);
@@ -693,14 +708,22 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
                                 double& T) {
     int displ_x = off_x - this->offset_x;
     int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsItems();
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts write only in their own range of the state vectors; the returned time is overwritten below.
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
     for (auto& link : linklist) {
         if (link->IsActive())
@@ -732,14 +755,19 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
     int displ_x = off_x - this->offset_x;
     int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreadsItems();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
                                    full_update);
@@ -940,12 +968,19 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsItems();
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts load forces only in their own range of R and can be processed concurrently (if enabled).
+    // Links, meshes, and other physics items may load forces on other items and are processed sequentially.
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -1049,6 +1084,7 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
                                      double recovery_clamp      ///< value for min/max clamping of c*C
 ) {
     int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreadsItems();
 
     for (auto& body : bodylist) {
         if (body->IsActive())
@@ -1058,7 +1094,10 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& link : linklist) {
+    // Links load constraint violations only in their own range of Qc and can be processed concurrently (if enabled).
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1076,6 +1115,7 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
                                       const double c             ///< a scaling factor
 ) {
     int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreadsItems();
 
     for (auto& body : bodylist) {
         if (body->IsActive())
@@ -1085,7 +1125,10 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
     }
-    for (auto& link : linklist) {
+    // Links load rheonomic terms only in their own range of Qc and can be processed concurrently (if enabled).
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) if (nthreads > 1)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
     }
@@ -1455,11 +1498,16 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (auto& body : bodylist) {
-        body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    // Bodies and shafts only write into their own KRM block and can be processed concurrently (if enabled).
+    int nthreads = GetNumThreadsItems();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        bodylist[ib]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        shaftlist[is]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
     for (auto& link : linklist) {
         link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
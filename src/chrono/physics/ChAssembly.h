@@ -114,6 +114,28 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Get the list of physics items that are not in the body or link lists.
     virtual const std::vector<std::shared_ptr<ChPhysicsItem>>& GetOtherPhysicsItems() const { return otherphysicslist; }
 
+    /// Enable/disable multithreaded processing of the items in this assembly (default: false).
+    /// If enabled, the loops over bodies and shafts in Update, IntStateGather, IntStateScatter, IntLoadResidual_F,
+    /// and LoadKRMMatrices, and the loops over links in IntLoadConstraint_C and IntLoadConstraint_Ct, are executed in
+    /// parallel, using the number of threads specified for Chrono in ChSystem::SetNumThreads. Results are identical to
+    /// those obtained with sequential processing:
+    /// - a body only modifies its own state, its gyroscopic and applied forces, and its child markers and forces,
+    ///   and writes only in its own range of the state vectors and in its own KRM block;
+    /// - a shaft only modifies its own state and writes only in its own range of the state vectors;
+    /// - a link loads its constraint violations and rheonomic terms only in its own range of the constraint vector,
+    ///   from data computed in its Update.
+    /// Other link operations are processed sequentially, since different links may share data which is modified in
+    /// these operations (e.g., markers used by several links, or the inner shafts of shaft-body links), as are meshes
+    /// and other physics items, which may load forces on other items.
+    /// When enabled, the following must not be shared between different bodies or links: marker motion functions,
+    /// applied force functions, and motor functions (some function types, e.g. ChFunctionInterp, cache lookup data
+    /// during evaluation), and visual shapes which are not stateless. Visual assets of different items may be updated
+    /// concurrently.
+    void EnableMultithreading(bool val) { m_multithreaded = val; }
+
+    /// Return true if multithreaded processing of the assembly items is enabled.
+    bool IsMultithreadingEnabled() const { return m_multithreaded; }
+
     /// Search a body by its name.
     std::shared_ptr<ChBody> SearchBody(const std::string& name) const;
     /// Search a body by its ID
@@ -323,6 +345,9 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Return the number of threads used in the loops over assembly items.
+    int GetNumThreadsItems() const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -347,6 +372,8 @@ class ChApi ChAssembly : public ChPhysicsItem {
     unsigned int m_num_constr_bil;  ///< number of scalar bilateral constraints
     unsigned int m_num_constr_uni;  ///< number of scalar unilateral constraints
 
+    bool m_multithreaded;  ///< process assembly items in parallel
+
     friend class ChSystem;
     friend class ChSystemMulticore;
 };
@@ -22,11 +22,13 @@
 
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactable.h"
 #include "chrono/physics/ChContactMaterial.h"
+#include "chrono/physics/ChContactPool.h"
 
 namespace chrono {
 
@@ -40,6 +42,28 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// Get the number of added contacts.
     virtual unsigned int GetNumContacts() const = 0;
 
+    /// Get the number of memory allocations for contact objects during the last collision detection pass.
+    /// The default implementation returns 0 (allocations not tracked).
+    virtual unsigned int GetNumAllocations() const { return 0; }
+
+    /// Contact force (Lagrange multipliers) of a contact between two bodies.
+    /// A contact is identified by the indices of the two bodies and by its rank among the contacts of the same pair.
+    struct ContactReaction {
+        unsigned int body_a;      ///< index of first body
+        unsigned int body_b;      ///< index of second body
+        unsigned int occurrence;  ///< rank of the contact among those between the same two bodies
+        ChVector3d force;         ///< contact force, in contact coordinate system
+    };
+
+    /// Gather the forces of the current contacts between bodies.
+    /// The default implementation does not report any contact.
+    virtual void GatherContactReactions(std::vector<ContactReaction>& reactions) {}
+
+    /// Set the contact forces used as initial guess for the contacts created at the next collision detection pass.
+    /// Contacts are matched by body pair and rank. This can be used to restore the persistent contact cache after a
+    /// rollback. The default implementation ignores the provided forces.
+    virtual void SetPendingContactReactions(const std::vector<ContactReaction>& reactions) {}
+
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() = 0;
 
@@ -149,49 +173,63 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     template <class Tcont>
     void SumAllContactForces(std::list<Tcont*>& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
-        for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
-            // Extract information for current contact (expressed in global frame)
-            ChMatrix33<> A = (*contact)->GetContactPlane();
-            ChVector3d force_loc = (*contact)->GetContactForce();
-            ChVector3d force = A * force_loc;
-            ChVector3d p1 = (*contact)->GetContactP1();
-            ChVector3d p2 = (*contact)->GetContactP2();
-
-            // Calculate contact torque for first object (expressed in global frame).
-            // Recall that -force is applied to the first object.
-            ChVector3d torque1(0);
-            if (ChBody* body = dynamic_cast<ChBody*>((*contact)->GetObjA())) {
-                torque1 = Vcross(p1 - body->GetPos(), -force);
-            }
-
-            // If there is already an entry for the first object, accumulate.
-            // Otherwise, insert a new entry.
-            auto entry1 = contactforces.find((*contact)->GetObjA());
-            if (entry1 != contactforces.end()) {
-                entry1->second.force -= force;
-                entry1->second.torque += torque1;
-            } else {
-                ForceTorque ft{-force, torque1};
-                contactforces.insert(std::make_pair((*contact)->GetObjA(), ft));
-            }
-
-            // Calculate contact torque for second object (expressed in global frame).
-            // Recall that +force is applied to the second object.
-            ChVector3d torque2(0);
-            if (ChBody* body = dynamic_cast<ChBody*>((*contact)->GetObjB())) {
-                torque2 = Vcross(p2 - body->GetPos(), force);
-            }
-
-            // If there is already an entry for the first object, accumulate.
-            // Otherwise, insert a new entry.
-            auto entry2 = contactforces.find((*contact)->GetObjB());
-            if (entry2 != contactforces.end()) {
-                entry2->second.force += force;
-                entry2->second.torque += torque2;
-            } else {
-                ForceTorque ft{force, torque2};
-                contactforces.insert(std::make_pair((*contact)->GetObjB(), ft));
-            }
+        for (auto contact : contactlist)
+            SumContactForces(*contact, contactforces);
+    }
+
+    /// Utility function to accumulate contact forces from a specified pool of contacts.
+    /// See SumAllContactForces for lists of contacts.
+    template <class Tcont>
+    void SumAllContactForces(ChContactPool<Tcont>& contactpool,
+                             std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
+        for (auto& contact : contactpool)
+            SumContactForces(contact, contactforces);
+    }
+
+    /// Utility function to accumulate the forces of a single contact.
+    template <class Tcont>
+    void SumContactForces(Tcont& contact, std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
+        // Extract information for current contact (expressed in global frame)
+        ChMatrix33<> A = contact.GetContactPlane();
+        ChVector3d force_loc = contact.GetContactForce();
+        ChVector3d force = A * force_loc;
+        ChVector3d p1 = contact.GetContactP1();
+        ChVector3d p2 = contact.GetContactP2();
+
+        // Calculate contact torque for first object (expressed in global frame).
+        // Recall that -force is applied to the first object.
+        ChVector3d torque1(0);
+        if (ChBody* body = dynamic_cast<ChBody*>(contact.GetObjA())) {
+            torque1 = Vcross(p1 - body->GetPos(), -force);
+        }
+
+        // If there is already an entry for the first object, accumulate.
+        // Otherwise, insert a new entry.
+        auto entry1 = contactforces.find(contact.GetObjA());
+        if (entry1 != contactforces.end()) {
+            entry1->second.force -= force;
+            entry1->second.torque += torque1;
+        } else {
+            ForceTorque ft{-force, torque1};
+            contactforces.insert(std::make_pair(contact.GetObjA(), ft));
+        }
+
+        // Calculate contact torque for second object (expressed in global frame).
+        // Recall that +force is applied to the second object.
+        ChVector3d torque2(0);
+        if (ChBody* body = dynamic_cast<ChBody*>(contact.GetObjB())) {
+            torque2 = Vcross(p2 - body->GetPos(), force);
+        }
+
+        // If there is already an entry for the first object, accumulate.
+        // Otherwise, insert a new entry.
+        auto entry2 = contactforces.find(contact.GetObjB());
+        if (entry2 != contactforces.end()) {
+            entry2->second.force += force;
+            entry2->second.torque += torque2;
+        } else {
+            ForceTorque ft{force, torque2};
+            contactforces.insert(std::make_pair(contact.GetObjB(), ft));
         }
     }
 };
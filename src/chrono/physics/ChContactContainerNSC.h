@@ -15,19 +15,19 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
-
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// reactions), stored in contiguous memory blocks. It might also contain ChContactNSCrolling objects (extended versions
+/// of ChContactNSC, with 6 reactions, that account also for rolling and spinning resistance), but also for '6dof vs
+/// 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -53,17 +53,37 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
+        return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                              contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                              contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                              contactlist_666_666.size() + contactlist_6_6_rolling.size());
+    }
+
+    /// Report the number of memory blocks allocated in the contact pools during the last collision detection pass.
+    virtual unsigned int GetNumAllocations() const override {
+        return (unsigned int)(contactlist_3_3.GetNumAllocated() + contactlist_6_3.GetNumAllocated() +
+                              contactlist_6_6.GetNumAllocated() + contactlist_333_3.GetNumAllocated() +
+                              contactlist_333_6.GetNumAllocated() + contactlist_333_333.GetNumAllocated() +
+                              contactlist_666_3.GetNumAllocated() + contactlist_666_6.GetNumAllocated() +
+                              contactlist_666_333.GetNumAllocated() + contactlist_666_666.GetNumAllocated() +
+                              contactlist_6_6_rolling.GetNumAllocated());
+    }
+
+    /// Gather the forces of the current contacts between bodies.
+    virtual void GatherContactReactions(std::vector<ContactReaction>& reactions) override;
+
+    /// Set the contact forces used as initial guess for the contacts between bodies created at the next collision
+    /// detection pass. The forces are applied only to contacts with a persistent reactions cache.
+    virtual void SetPendingContactReactions(const std::vector<ContactReaction>& reactions) override {
+        pending_reactions = reactions;
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the
+    /// contact pools and reuses previous contact objects until possible, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -78,8 +98,9 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
-    /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
+    /// similar). Contact objects that were not reused are kept in the pools (inactive) for later steps, unless pool
+    /// trimming is enabled (see SetContactPoolTrimming), in which case they are destroyed.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -119,14 +140,22 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual unsigned int GetNumConstraintsUnilateral() override {
-        return 3 * (n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-                    n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666) +
-               6 * (n_added_6_6_rolling);
+        return (unsigned int)(3 * (contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                                   contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                                   contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                                   contactlist_666_666.size()) +
+                              6 * contactlist_6_6_rolling.size());
     }
 
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
     double GetMinBounceSpeed() const { return min_bounce_speed; }
 
+    /// Enable/disable trimming of the contact pools at the end of each collision detection pass (default: false).
+    /// If disabled, contact objects that are not reused are kept for later steps so that, once the pools are warmed
+    /// up, no allocations take place. If enabled, unused contact objects are destroyed and the associated memory is
+    /// released (this may be useful after a transient with a much larger number of contacts).
+    void SetContactPoolTrimming(bool val) { trim_pools = val; }
+
     /// Update state of this contact container: compute jacobians, violations, etc.
     /// and store results in inner structures of contacts.
     virtual void Update(double mtime, bool update_assets = true) override;
@@ -182,43 +211,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -226,6 +230,9 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
+    bool trim_pools;          ///< release unused contact objects at the end of each collision detection pass
+
+    std::vector<ContactReaction> pending_reactions;  ///< contact forces to apply at the next collision detection pass
 
     friend class ChSystemNSC;
 };
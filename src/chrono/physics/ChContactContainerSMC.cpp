@@ -30,7 +30,9 @@ ChContactContainerSMC::ChContactContainerSMC()
       n_added_666_3(0),
       n_added_666_6(0),
       n_added_666_333(0),
-      n_added_666_666(0) {}
+      n_added_666_666(0),
+      n_stored(0),
+      n_allocated(0) {}
 
 ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
     n_added_3_3 = 0;
@@ -43,6 +45,8 @@ ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
     n_added_666_6 = 0;
     n_added_666_333 = 0;
     n_added_666_666 = 0;
+    n_stored = 0;
+    n_allocated = 0;
 }
 
 ChContactContainerSMC::~ChContactContainerSMC() {
@@ -81,7 +85,17 @@ void ChContactContainerSMC::RemoveAllContacts() {
     //**TODO*** cont. roll.
 }
 
+unsigned int ChContactContainerSMC::GetNumStored() const {
+    return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                          contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                          contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                          contactlist_666_666.size());
+}
+
 void ChContactContainerSMC::BeginAddContact() {
+    // contact lists only grow while contacts are added
+    n_stored = GetNumStored();
+
     lastcontact_3_3 = contactlist_3_3.begin();
     n_added_3_3 = 0;
 
@@ -117,6 +131,8 @@ void ChContactContainerSMC::BeginAddContact() {
 }
 
 void ChContactContainerSMC::EndAddContact() {
+    n_allocated = GetNumStored() - n_stored;
+
     // remove contacts that are beyond last contact
     while (lastcontact_3_3 != contactlist_3_3.end()) {
         delete (*lastcontact_3_3);
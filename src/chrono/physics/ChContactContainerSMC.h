@@ -63,6 +63,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     int n_added_666_333;
     int n_added_666_666;
 
+    unsigned int n_stored;     ///< number of contact objects at the beginning of the collision detection pass
+    unsigned int n_allocated;  ///< number of contact objects allocated during the last collision detection pass
+
     std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
     std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
     std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
@@ -76,6 +79,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    // Return the total number of contact objects in the contact lists (active or available for reuse).
+    unsigned int GetNumStored() const;
+
   public:
     ChContactContainerSMC();
     ChContactContainerSMC(const ChContactContainerSMC& other);
@@ -90,6 +96,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
                n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666;
     }
 
+    /// Report the number of contact objects allocated during the last collision detection pass.
+    virtual unsigned int GetNumAllocations() const override { return n_allocated; }
+
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
@@ -128,6 +128,19 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector3d GetContactForce() const override { return react_force; }
 
+    /// Set the contact force stored in the persistent contact manifold, if any, and used as initial guess.
+    /// This has the same effect as a reset of the contact with the given force in the reactions cache.
+    void SetCachedContactForce(const ChVector3d& force) {
+        if (reactions_cache) {
+            reactions_cache[0] = (float)force.x();
+            reactions_cache[1] = (float)force.y();
+            reactions_cache[2] = (float)force.z();
+            react_force.x() = reactions_cache[0];
+            react_force.y() = reactions_cache[1];
+            react_force.z() = reactions_cache[2];
+        }
+    }
+
     /// Get the contact friction coefficient
     virtual double GetFriction() { return Nx.GetFrictionCoefficient(); }
 
@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace chrono {
+
+/// Pool of contact objects stored in contiguous, fixed-size memory blocks.
+/// Contacts are constructed in place and never moved, so their addresses (and hence the addresses of the constraints
+/// they inject in the system descriptor) stay valid. Each contact is identified by a stable index in [0, size()).
+/// The pool is rewound at the beginning of each collision detection pass and already constructed contacts are
+/// reinitialized and reused; new contacts are constructed only when the number of contacts exceeds the previous
+/// maximum, so that, once warmed up, no allocations or deallocations take place.
+template <class Tcont, std::size_t BlockSize = 256>
+class ChContactPool {
+  public:
+    template <class Tpool, class Tref>
+    class Iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Tcont;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Tcont*;
+        using reference = Tref;
+
+        Iterator(Tpool* pool, std::size_t index) : m_pool(pool), m_index(index) {}
+
+        reference operator*() const { return (*m_pool)[m_index]; }
+        pointer operator->() const { return &(*m_pool)[m_index]; }
+        Iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        Tpool* m_pool;
+        std::size_t m_index;
+    };
+
+    typedef Iterator<ChContactPool, Tcont&> iterator;
+    typedef Iterator<const ChContactPool, const Tcont&> const_iterator;
+
+    ChContactPool() : m_num_active(0), m_num_constructed(0), m_num_allocated(0) {}
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+    ~ChContactPool() { Clear(); }
+
+    /// Return the number of active contacts (added since the last call to Rewind).
+    std::size_t size() const { return m_num_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_num_active == 0; }
+
+    /// Return the number of contact objects constructed in the pool (active or available for reuse).
+    std::size_t GetNumConstructed() const { return m_num_constructed; }
+
+    /// Return the number of contact objects that can be stored without allocating a new memory block.
+    std::size_t GetCapacity() const { return m_blocks.size() * BlockSize; }
+
+    /// Return the number of memory blocks allocated since the last call to Rewind.
+    std::size_t GetNumAllocated() const { return m_num_allocated; }
+
+    /// Access the contact with specified index.
+    Tcont& operator[](std::size_t index) { return m_blocks[index / BlockSize][index % BlockSize]; }
+    const Tcont& operator[](std::size_t index) const { return m_blocks[index / BlockSize][index % BlockSize]; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_num_active); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_num_active); }
+
+    /// Mark all contacts as inactive, making them available for reuse.
+    void Rewind() {
+        m_num_active = 0;
+        m_num_allocated = 0;
+    }
+
+    /// Return true if a previously constructed contact object is available for reuse.
+    bool CanReuse() const { return m_num_active < m_num_constructed; }
+
+    /// Activate the next previously constructed contact object and return it.
+    /// The caller is responsible for reinitializing it.
+    Tcont& Reuse() {
+        assert(CanReuse());
+        return (*this)[m_num_active++];
+    }
+
+    /// Construct a new contact object in place, with the given constructor arguments, and activate it.
+    /// A new memory block is allocated only if all existing blocks are full.
+    template <typename... Args>
+    Tcont& Create(Args&&... args) {
+        assert(!CanReuse());
+        if (m_num_constructed == GetCapacity()) {
+            m_blocks.push_back(m_allocator.allocate(BlockSize));
+            m_num_allocated++;
+        }
+        Tcont* slot = &(*this)[m_num_constructed];
+        ::new (static_cast<void*>(slot)) Tcont(std::forward<Args>(args)...);
+        m_num_constructed++;
+        m_num_active++;
+        return *slot;
+    }
+
+    /// Destroy the inactive contact objects and release memory blocks that are no longer used.
+    void Trim() {
+        while (m_num_constructed > m_num_active) {
+            m_num_constructed--;
+            (*this)[m_num_constructed].~Tcont();
+        }
+        std::size_t num_blocks = (m_num_constructed + BlockSize - 1) / BlockSize;
+        while (m_blocks.size() > num_blocks) {
+            m_allocator.deallocate(m_blocks.back(), BlockSize);
+            m_blocks.pop_back();
+        }
+    }
+
+    /// Destroy all contact objects and release all memory.
+    void Clear() {
+        m_num_active = 0;
+        Trim();
+    }
+
+  private:
+    std::vector<Tcont*> m_blocks;                ///< memory blocks, each holding BlockSize contacts
+    Eigen::aligned_allocator<Tcont> m_allocator;  ///< allocator for memory blocks
+    std::size_t m_num_active;                     ///< number of active contacts
+    std::size_t m_num_constructed;                ///< number of constructed contact objects
+    std::size_t m_num_allocated;                  ///< number of memory blocks allocated since last rewind
+};
+
+}  // end namespace chrono
+
+#endif
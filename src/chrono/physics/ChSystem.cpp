@@ -52,11 +52,13 @@ ChSystem::ChSystem()
       m_num_constr_uni(0),
       ch_time(0),
       m_RTF(0),
+      perf_counters_enabled(false),
       step(0.04),
       use_sleeping(false),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
       setupcount(0),
+      setupcount_total(0),
       solvecount(0),
       write_matrix(false),
       ncontacts(0),
@@ -66,6 +68,7 @@ ChSystem::ChSystem()
       nthreads_chrono(1),
       nthreads_eigen(1),
       nthreads_collision(1),
+      deterministic(false),
       applied_forces_current(false) {
     assembly.system = this;
 
@@ -77,7 +80,8 @@ ChSystem::ChSystem()
     timestepper = chrono_types::make_shared<ChTimestepperEulerImplicitLinearized>(this);
 }
 
-ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr), visual_system(nullptr) {
+ChSystem::ChSystem(const ChSystem& other)
+    : m_RTF(0), perf_counters_enabled(false), collision_system(nullptr), visual_system(nullptr) {
     // Required by ChAssembly
     assembly = other.assembly;
     assembly.system = this;
@@ -93,12 +97,14 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     stepcount = other.stepcount;
     solvecount = other.solvecount;
     setupcount = other.setupcount;
+    setupcount_total = 0;
     write_matrix = other.write_matrix;
     output_dir = other.output_dir;
     SetTimestepperType(other.GetTimestepperType());
     nthreads_chrono = other.nthreads_chrono;
     nthreads_eigen = other.nthreads_eigen;
     nthreads_collision = other.nthreads_collision;
+    deterministic = other.deterministic;
     is_initialized = false;
     is_updated = false;
     applied_forces_current = false;
@@ -252,6 +258,8 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         return;
 
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+    descriptor->SetNumThreads(nthreads_chrono);
+    setupcount_total++;
 
     switch (type) {
         case ChSolver::Type::PSOR:
@@ -314,11 +322,14 @@ void ChSystem::UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollision
 void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor) {
     assert(newdescriptor);
     descriptor = newdescriptor;
+    descriptor->SetNumThreads(nthreads_chrono);
+    setupcount_total++;
 }
 
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    setupcount_total++;
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -350,6 +361,7 @@ void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
     }
 
     collision_system->SetNumThreads(nthreads_collision);
+    collision_system->SetDeterministic(deterministic);
     collision_system->SetSystem(this);
 }
 
@@ -357,6 +369,7 @@ void ChSystem::SetCollisionSystem(std::shared_ptr<ChCollisionSystem> coll_system
     assert(coll_system);
     collision_system = coll_system;
     collision_system->SetNumThreads(nthreads_collision);
+    collision_system->SetDeterministic(deterministic);
     collision_system->SetSystem(this);
 }
 
@@ -375,10 +388,20 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
     nthreads_collision = (num_threads_collision <= 0) ? num_threads_chrono : num_threads_collision;
     nthreads_eigen = (num_threads_eigen <= 0) ? num_threads_chrono : num_threads_eigen;
 
+    if (descriptor)
+        descriptor->SetNumThreads(nthreads_chrono);
+
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
 }
 
+void ChSystem::EnableDeterministic(bool val) {
+    deterministic = val;
+
+    if (collision_system)
+        collision_system->SetDeterministic(deterministic);
+}
+
 // -----------------------------------------------------------------------------
 
 // Initial system setup before analysis. Must be called once the system construction is completed.
@@ -863,6 +886,9 @@ void ChSystem::LoadConstraintJacobians() {
 
     // Use also on contact container:
     contact_container->LoadConstraintJacobians();
+
+    // Packed Jacobians used for sparse products (if enabled) must be rebuilt
+    descriptor->InvalidateSparseProducts();
 }
 
 void ChSystem::ConstraintsFetch_react(double factor) {
@@ -1074,6 +1100,7 @@ bool ChSystem::StateSolveCorrection(
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
         setupcount++;
+        setupcount_total++;
         if (!success)
             return false;
     }
@@ -1295,6 +1322,47 @@ double ChSystem::GetTimerCollisionNarrow() const {
     return 0;
 }
 
+void ChSystem::EnablePerformanceCounters(bool val) {
+    perf_counters_enabled = val;
+    if (!val)
+        return;
+
+    // Register the built-in counters (re-registering an existing counter only replaces its provider)
+    perf_counters.Register("step", [this]() { return timer_step(); });
+    perf_counters.Register("advance", [this]() { return timer_advance(); });
+    perf_counters.Register("setup", [this]() { return timer_setup(); });
+    perf_counters.Register("update", [this]() { return timer_update(); });
+    perf_counters.Register("jacobian", [this]() { return timer_jacobian(); });
+    perf_counters.Register("ls_setup", [this]() { return timer_ls_setup(); });
+    perf_counters.Register("ls_solve", [this]() { return timer_ls_solve(); });
+    perf_counters.Register("collision", [this]() { return timer_collision(); });
+    perf_counters.Register("collision_broad", [this]() { return GetTimerCollisionBroad(); });
+    perf_counters.Register("collision_narrow", [this]() { return GetTimerCollisionNarrow(); });
+    perf_counters.Register("rtf", [this]() { return step > 0 ? timer_step() / step : 0.0; });
+    perf_counters.Register("num_contacts", [this]() { return (double)ncontacts; });
+    perf_counters.Register("allocations", [this]() { return (double)contact_container->GetNumAllocations(); });
+    perf_counters.Register("solver_iterations", [this]() {
+        auto iterative = std::dynamic_pointer_cast<ChIterativeSolver>(solver);
+        return iterative ? (double)iterative->GetIterations() : 0.0;
+    });
+    perf_counters.Register("solver_residual", [this]() {
+        auto iterative = std::dynamic_pointer_cast<ChIterativeSolver>(solver);
+        return iterative ? iterative->GetError() : 0.0;
+    });
+    perf_counters.Register("newton_iterations", [this]() {
+        auto implicit = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(timestepper);
+        return implicit ? (double)implicit->GetNumIterations() : 0.0;
+    });
+    perf_counters.Register("newton_setups", [this]() {
+        auto implicit = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(timestepper);
+        return implicit ? (double)implicit->GetNumSetupCalls() : 0.0;
+    });
+    perf_counters.Register("matrix_nnz", [this]() {
+        auto direct = std::dynamic_pointer_cast<ChDirectSolverLS>(solver);
+        return direct ? (double)direct->GetMatrix().nonZeros() : 0.0;
+    });
+}
+
 void ChSystem::ResetTimers() {
     timer_step.reset();
     timer_advance.reset();
@@ -1619,6 +1687,10 @@ bool ChSystem::AdvanceDynamics() {
     // Time elapsed for step
     timer_step.stop();
 
+    // Record performance counters for this step
+    if (perf_counters_enabled)
+        perf_counters.Sample(ch_time);
+
     // Update the run-time visualization system, if present
     if (visual_system)
         visual_system->OnUpdate(this);
@@ -26,6 +26,7 @@
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/core/ChTimer.h"
+#include "chrono/core/ChPerformanceCounters.h"
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/utils/ChOpenMP.h"
 #include "chrono/physics/ChAssembly.h"
@@ -256,8 +257,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and in the assembly update
+    ///                           (if enabled; see EnableAssemblyMultithreading).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -276,6 +278,23 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     unsigned int GetNumThreadsCollision() const { return nthreads_collision; }
     unsigned int GetNumThreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable deterministic multithreading (default: false).
+    /// If enabled, all multithreaded calculations in Chrono use a fixed reduction order (e.g., FEA internal forces are
+    /// always accumulated element color by element color) and the collision system produces contacts in a fixed order,
+    /// so that results are bitwise reproducible from run to run and independent of the number of threads (see
+    /// SetNumThreads). This may incur a small performance penalty, in particular when running single-threaded.
+    /// Note that results may still differ across platforms, compilers, or builds with different vectorization options.
+    void EnableDeterministic(bool val);
+
+    /// Return true if deterministic multithreading is enabled.
+    bool IsDeterministic() const { return deterministic; }
+
+    /// Enable/disable multithreaded processing of the items in the underlying assembly.
+    /// If enabled, num_threads_chrono threads are used for the loops over bodies and shafts in the system update, state
+    /// gather/scatter, force and KRM loading operations, and for the loops over links in the constraint loading
+    /// operations. See ChAssembly::EnableMultithreading.
+    void EnableAssemblyMultithreading(bool val) { assembly.EnableMultithreading(val); }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -521,6 +540,16 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Resets the timers.
     void ResetTimers();
 
+    /// Enable/disable recording of performance counters at the end of each step (default: false).
+    /// When enabled, the system registers built-in counters (timers, number of contacts, allocations of contact
+    /// objects, solver iterations and residual, Newton iterations and matrix setups, system matrix non-zeros, RTF).
+    /// Other subsystems or user code can register additional counters in the registry returned by
+    /// GetPerformanceCounters().
+    void EnablePerformanceCounters(bool val);
+
+    /// Return the registry of per-step performance counters.
+    ChPerformanceCounters& GetPerformanceCounters() { return perf_counters; }
+
     /// DEBUGGING
 
     /// Enable/disable debug output of system matrices.
@@ -621,7 +650,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     void InjectConstraints(ChSystemDescriptor& sys_descriptor);
 
     /// Compute and load current Jacobians in encapsulated ChConstraint objects.
-    void LoadConstraintJacobians();
+    virtual void LoadConstraintJacobians() override;
 
     /// Register with the given system descriptor any ChKRMBlock objects associated with items in the system.
     void InjectKRMMatrices(ChSystemDescriptor& sys_descriptor);
@@ -658,6 +687,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Get the number of scalar constraints in the system.
     virtual unsigned int GetNumConstraints() override { return m_num_constr; }
 
+    /// Return a counter identifying the current setup of the linear solver.
+    /// This counter is incremented at each call to the solver's Setup() and whenever the solver is replaced.
+    virtual unsigned int GetSolverSetupCounter() const override { return setupcount_total; }
+
     /// Get the number of bilateral scalar constraints.
     virtual unsigned int GetNumConstraintsBilateral() { return m_num_constr_bil; }
 
@@ -821,7 +854,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     size_t stepcount;  ///< internal counter for steps
 
-    unsigned int setupcount;  ///< number of calls to the solver's Setup()
+    unsigned int setupcount;        ///< number of calls to the solver's Setup()
+    unsigned int setupcount_total;  ///< counter of solver setups (never reset)
     unsigned int solvecount;  ///< number of StateSolveCorrection (reset to 0 at each timestep of static analysis)
 
     bool write_matrix;       ///< write current system matrix to file(s); for debugging
@@ -839,6 +873,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int nthreads_chrono;
     int nthreads_eigen;
     int nthreads_collision;
+    bool deterministic;
 
     // timers for profiling execution speed
     ChTimer timer_step;       ///< timer for integration step
@@ -851,6 +886,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     ChTimer timer_update;     ///< timer for system update
     double m_RTF;             ///< real-time factor (simulation time / simulated time)
 
+    bool perf_counters_enabled;           ///< record performance counters at each step?
+    ChPerformanceCounters perf_counters;  ///< registry of per-step performance counters
+
     std::shared_ptr<ChTimestepper> timestepper;  ///< time-stepper object
 
     ChVectorDynamic<> applied_forces;  ///< system-wide vector of applied forces (lazy evaluation)
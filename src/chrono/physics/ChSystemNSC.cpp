@@ -32,6 +32,7 @@ CH_FACTORY_REGISTER(ChSystemNSC)
 ChSystemNSC::ChSystemNSC() : ChSystem() {
     // Set the system descriptor
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+    descriptor->SetNumThreads(nthreads_chrono);
 
     // Set default solver
     SetSolverType(ChSolver::Type::PSOR);
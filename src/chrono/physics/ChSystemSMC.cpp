@@ -40,6 +40,7 @@ ChSystemSMC::ChSystemSMC()
       m_force_algo(new ChDefaultContactForceTorqueSMC) {
     // Set the system descriptor
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+    descriptor->SetNumThreads(nthreads_chrono);
 
     // Set default solver
     SetSolverType(ChSolver::Type::PSOR);
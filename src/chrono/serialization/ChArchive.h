@@ -888,8 +888,28 @@ class ChApi ChArchiveOut : public ChArchive {
     virtual void out_array_between(ChValue& bVal, size_t msize) = 0;
     virtual void out_array_end(ChValue& bVal, size_t msize) = 0;
 
+    // for contiguous blocks of arithmetic values inside an array (optional fast path).
+    // Return false if not supported by the archive, in which case values are output one at a time.
+    virtual bool out_array_block(const void* data, size_t elem_size, size_t msize) { return false; }
+
     //---------------------------------------------------
 
+    /// Output a contiguous array of arithmetic values.
+    /// Archives that support it (e.g., binary archives) write the entire block with a single call.
+    template <class T>
+    void out_array(ChValue& specVal, const T* data, size_t size) {
+        this->out_array_pre(specVal, size);
+        if (!this->out_array_block(data, sizeof(T), size)) {
+            for (size_t i = 0; i < size; ++i) {
+                T element = data[i];
+                ChNameValue<T> array_val(std::to_string(i), element);
+                this->out(array_val);
+                this->out_array_between(specVal, size);
+            }
+        }
+        this->out_array_end(specVal, size);
+    }
+
     // trick to wrap enum mappers:
     template <class T>
     void out(ChNameValue<ChEnumMapper<T>> bVal) {
@@ -918,6 +938,10 @@ class ChApi ChArchiveOut : public ChArchive {
     void out(ChNameValue<std::vector<T>> bVal) {
         ChValueSpecific<std::vector<T>> specVal(bVal.value(), bVal.name(), bVal.flags(), bVal.GetCausality(),
                                                 bVal.GetVariability());
+        if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) {
+            this->out_array(specVal, bVal.value().data(), bVal.value().size());
+            return;
+        }
         this->out_array_pre(specVal, bVal.value().size());
         for (size_t i = 0; i < bVal.value().size(); ++i) {
             ChNameValue<T> array_val(std::to_string(i), bVal.value()[i]);
@@ -1175,8 +1199,26 @@ class ChApi ChArchiveIn : public ChArchive {
     virtual void in_array_between(const std::string& name) = 0;
     virtual void in_array_end(const std::string& name) = 0;
 
+    // for contiguous blocks of arithmetic values inside an array (optional fast path).
+    // Return false if not supported by the archive, in which case values are input one at a time.
+    virtual bool in_array_block(void* data, size_t elem_size, size_t msize) { return false; }
+
     //---------------------------------------------------
 
+    /// Input a contiguous array of arithmetic values, after a call to in_array_pre returned its size.
+    /// Archives that support it (e.g., binary archives) read the entire block with a single call.
+    template <class T>
+    void in_array(const std::string& name, T* data, size_t size) {
+        if (!this->in_array_block(data, sizeof(T), size)) {
+            for (size_t i = 0; i < size; ++i) {
+                ChNameValue<T> array_val(std::to_string(i), data[i]);
+                this->in(array_val);
+                this->in_array_between(name);
+            }
+        }
+        this->in_array_end(name);
+    }
+
     // trick to wrap enum mappers:
     template <class T>
     bool in(ChNameValue<ChEnumMapper<T>> bVal) {
@@ -1214,6 +1256,10 @@ class ChApi ChArchiveIn : public ChArchive {
         if (!this->in_array_pre(bVal.name(), arraysize))  // TODO: DARIOM check why it was commented out
             return false;
         bVal.value().resize(arraysize);
+        if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) {
+            this->in_array(bVal.name(), bVal.value().data(), arraysize);
+            return true;
+        }
         for (size_t i = 0; i < arraysize; ++i) {
             T element;
             ChNameValue<T> array_val(std::to_string(i), element);
@@ -1,3 +1,17 @@
+#include <algorithm>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 #include "chrono/serialization/ChArchiveBinary.h"
 
 namespace chrono {
@@ -59,6 +73,11 @@ void ChArchiveOutBinary::out_array_between(ChValue& bVal, size_t size) {}
 
 void ChArchiveOutBinary::out_array_end(ChValue& bVal, size_t size) {}
 
+bool ChArchiveOutBinary::out_array_block(const void* data, size_t elem_size, size_t size) {
+    m_ostream.write(static_cast<const char*>(data), elem_size * size);
+    return true;
+}
+
 // for custom c++ objects:
 
 void ChArchiveOutBinary::out(ChValue& bVal, bool tracked, size_t obj_ID) {
@@ -186,6 +205,16 @@ bool ChArchiveInBinary::in_array_pre(const std::string& name, size_t& size) {
     return true;
 }
 
+bool ChArchiveInBinary::in_array_block(void* data, size_t elem_size, size_t size) {
+    char* bytes = static_cast<char*>(data);
+    m_istream.read(bytes, elem_size * size);
+    if (m_big_endian_machine && elem_size > 1) {
+        for (size_t i = 0; i < size; i++)
+            std::reverse(bytes + i * elem_size, bytes + (i + 1) * elem_size);
+    }
+    return true;
+}
+
 bool ChArchiveInBinary::in_ref(ChNameValue<ChFunctorArchiveIn> bVal, void** ptr, std::string& true_classname) {
     void* new_ptr = nullptr;
 
@@ -306,4 +335,129 @@ std::istream& ChArchiveInBinary::read(char*& val) {
     return m_istream.read(val, str_len);
 }
 
+// -----------------------------------------------------------------------------
+
+// Read-only memory mapping of a file, exposed as an input stream.
+class ChMappedFile {
+  public:
+    ChMappedFile(const std::string& filename) : m_data(nullptr), m_size(0), m_buf(), m_stream(&m_buf) {
+#if defined(_WIN32)
+        m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, NULL);
+        m_mapping = NULL;
+        if (m_file != INVALID_HANDLE_VALUE) {
+            LARGE_INTEGER fsize;
+            if (GetFileSizeEx(m_file, &fsize) && fsize.QuadPart > 0) {
+                m_size = (size_t)fsize.QuadPart;
+                m_mapping = CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+                if (m_mapping)
+                    m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+            }
+        }
+#else
+        m_fd = open(filename.c_str(), O_RDONLY);
+        if (m_fd >= 0) {
+            struct stat st;
+            if (fstat(m_fd, &st) == 0 && st.st_size > 0) {
+                m_size = (size_t)st.st_size;
+                void* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+                if (addr != MAP_FAILED)
+                    m_data = static_cast<const char*>(addr);
+            }
+        }
+#endif
+        if (!m_data)
+            m_size = 0;
+        m_buf.Set(m_data, m_size);
+        if (!m_data)
+            m_stream.setstate(std::ios::failbit);
+    }
+
+    ~ChMappedFile() {
+#if defined(_WIN32)
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(m_file);
+#else
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+        if (m_fd >= 0)
+            close(m_fd);
+#endif
+    }
+
+    bool IsOpen() const { return m_data != nullptr; }
+    const char* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+    std::istream& GetStream() { return m_stream; }
+
+  private:
+    // Stream buffer reading directly from the mapped memory
+    class MemoryBuffer : public std::streambuf {
+      public:
+        void Set(const char* data, size_t size) {
+            char* begin = const_cast<char*>(data);
+            setg(begin, begin, begin + size);
+        }
+
+      protected:
+        virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+            off_type pos = off;
+            if (dir == std::ios_base::cur)
+                pos += gptr() - eback();
+            else if (dir == std::ios_base::end)
+                pos += egptr() - eback();
+            return seekpos(pos_type(pos), which);
+        }
+
+        virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+            if (!(which & std::ios_base::in) || pos < 0 || pos > egptr() - eback())
+                return pos_type(off_type(-1));
+            setg(eback(), eback() + off_type(pos), egptr());
+            return pos;
+        }
+    };
+
+#if defined(_WIN32)
+    HANDLE m_file;
+    HANDLE m_mapping;
+#else
+    int m_fd;
+#endif
+    const char* m_data;
+    size_t m_size;
+    MemoryBuffer m_buf;
+    std::istream m_stream;
+};
+
+ChArchiveInBinaryMapped::ChArchiveInBinaryMapped(const std::string& filename)
+    : ChArchiveInBinaryMapped(new ChMappedFile(filename)) {}
+
+ChArchiveInBinaryMapped::ChArchiveInBinaryMapped(ChMappedFile* file)
+    : ChArchiveInBinary(file->GetStream()), m_file(file) {}
+
+ChArchiveInBinaryMapped::~ChArchiveInBinaryMapped() {}
+
+bool ChArchiveInBinaryMapped::IsOpen() const {
+    return m_file->IsOpen();
+}
+
+const char* ChArchiveInBinaryMapped::in_array_view(const std::string& name, size_t elem_size, size_t& size) {
+    if (m_big_endian_machine)
+        throw std::runtime_error("Array views are not supported on big-endian machines");
+
+    in_array_pre(name, size);
+    std::streamoff offset = m_istream.tellg();
+    if (!m_istream || offset < 0 || (size_t)offset + elem_size * size > m_file->GetSize())
+        throw std::runtime_error("Cannot read array '" + name + "' from mapped archive");
+
+    m_istream.seekg(elem_size * size, std::ios_base::cur);
+    in_array_end(name);
+
+    return m_file->GetData() + offset;
+}
+
 }  // end namespace chrono
\ No newline at end of file
@@ -67,6 +67,7 @@ class ChApi ChArchiveOutBinary : public ChArchiveOut {
     virtual void out_array_pre(ChValue& bVal, size_t size);
     virtual void out_array_between(ChValue& bVal, size_t size);
     virtual void out_array_end(ChValue& bVal, size_t size);
+    virtual bool out_array_block(const void* data, size_t elem_size, size_t size) override;
 
     // for custom c++ objects:
     virtual void out(ChValue& bVal, bool tracked, size_t obj_ID);
@@ -127,6 +128,7 @@ class ChApi ChArchiveInBinary : public ChArchiveIn {
     virtual bool in_array_pre(const std::string& name, size_t& size) override;
     virtual void in_array_between(const std::string& name) override {}
     virtual void in_array_end(const std::string& name) override {}
+    virtual bool in_array_block(void* data, size_t elem_size, size_t size) override;
 
     // for custom c++ objects
     virtual bool in(ChNameValue<ChFunctorArchiveIn> bVal) override;
@@ -157,6 +159,44 @@ std::istream& ChArchiveInBinary::read(bool& val);
 template <>
 std::istream& ChArchiveInBinary::read(char*& val);
 
+class ChMappedFile;
+
+/// Deserialization from a memory-mapped binary file.
+/// This archive reads data written by ChArchiveOutBinary directly from a read-only memory mapping of the file, which
+/// avoids buffered stream I/O when loading large archives. In addition, custom ArchiveIn functions can obtain views
+/// into the mapped file for large arrays of arithmetic values (see in_array_view), without copying them.
+///
+/// Typical usage:
+/// \code{.cpp}
+/// ChArchiveInBinaryMapped archivein("/file.dat");
+/// archivein >> CHNVP(myobj);
+/// \endcode
+class ChApi ChArchiveInBinaryMapped : public ChArchiveInBinary {
+  public:
+    ChArchiveInBinaryMapped(const std::string& filename);
+
+    virtual ~ChArchiveInBinaryMapped();
+
+    /// Return true if the file was successfully mapped.
+    bool IsOpen() const;
+
+    /// Read the size of an array of arithmetic values written with ChArchiveOut::out_array (or as a std::vector or a
+    /// dense matrix data block) and return a pointer to its first element in the mapped file.
+    /// The view remains valid for the lifetime of this archive. Note that the returned data is not necessarily aligned
+    /// to the size of T. Views are only available on little-endian machines (an exception is thrown otherwise).
+    template <class T>
+    const T* in_array_view(const std::string& name, size_t& size) {
+        return reinterpret_cast<const T*>(in_array_view(name, sizeof(T), size));
+    }
+
+  private:
+    ChArchiveInBinaryMapped(ChMappedFile* file);
+
+    const char* in_array_view(const std::string& name, size_t elem_size, size_t& size);
+
+    std::unique_ptr<ChMappedFile> m_file;
+};
+
 }  // end namespace chrono
 
 #endif
@@ -15,12 +15,17 @@
 #ifndef CHCONSTRAINT_H
 #define CHCONSTRAINT_H
 
+#include <algorithm>
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 
+class ChVariables;
+
 /// Base class for representing constraints (bilateral or unilateral).
 /// These constraints are used with variational inequality or DAE solvers for problems including equalities,
 /// inequalities, nonlinearities, etc.
@@ -226,6 +231,33 @@ class ChApi ChConstraint {
                                              unsigned int start_row,
                                              unsigned int start_col) const = 0;
 
+    /// Append to the given list the variables referenced by this constraint (i.e., the variables modified by
+    /// IncrementState). Used by multithreaded solvers to identify constraints which can be processed concurrently.
+    /// Return false if this information is not available (default), in which case such a constraint is assumed to
+    /// conflict with all other constraints.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const { return false; }
+
+    /// Append the entries of the constraint Jacobian to the given vector.
+    /// Used to save the Jacobian loaded at the last solver setup (e.g., in a state snapshot), so that it can be
+    /// restored without being re-evaluated. The default implementation appends nothing.
+    virtual void GatherJacobian(std::vector<double>& data) const {}
+
+    /// Set the entries of the constraint Jacobian saved with GatherJacobian, reading from the given position.
+    /// Return the position following the last entry read.
+    virtual size_t ScatterJacobian(const std::vector<double>& data, size_t pos) { return pos; }
+
+    /// Append the entries of a block of a constraint Jacobian to the given vector.
+    static void GatherJacobianBlock(std::vector<double>& data, ChRowVectorConstRef Cq) {
+        data.insert(data.end(), Cq.data(), Cq.data() + Cq.size());
+    }
+
+    /// Set the entries of a block of a constraint Jacobian, reading from the given position.
+    /// Return the position following the last entry read.
+    static size_t ScatterJacobianBlock(const std::vector<double>& data, size_t pos, ChRowVectorRef Cq) {
+        std::copy(data.begin() + pos, data.begin() + pos + Cq.size(), Cq.data());
+        return pos + Cq.size();
+    }
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(unsigned int off) { offset = off; }
 
@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+
+#include "chrono/solver/ChConstraintColoring.h"
+
+namespace chrono {
+
+void ChConstraintColoring::Update(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& constraints = sysd.GetConstraints();
+    const unsigned int nConstr = (unsigned int)constraints.size();
+
+    // Bit masks of the colors already used by the blocks referencing each active variable (indexed by variable offset)
+    m_var_colors.assign(sysd.CountActiveVariables(), 0);
+
+    m_all_blocks.clear();
+    m_block_color.clear();
+
+    // 1)  Group constraints in blocks (friction triplets n,u,v or single constraints) and assign to each block the
+    //     first color not already used by any of its active variables.
+    int num_colors = 0;
+    unsigned int ic = 0;
+    while (ic < nConstr) {
+        Block block;
+        block.start = ic;
+        block.size = (constraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) ? 3 : 1;
+        assert(ic + block.size <= nConstr);
+        ic += block.size;
+
+        if (!constraints[block.start]->IsActive())
+            continue;
+
+        m_block_vars.clear();
+        bool known = true;
+        for (unsigned int k = block.start; k < block.start + block.size; k++)
+            known = constraints[k]->AppendVariables(m_block_vars) && known;
+
+        int color = -1;
+        if (known) {
+            uint64_t used = 0;
+            for (auto var : m_block_vars) {
+                if (var && var->IsActive())
+                    used |= m_var_colors[var->GetOffset()];
+            }
+            for (int c = 0; c < MAX_COLORS; c++) {
+                if (!(used & (uint64_t(1) << c))) {
+                    color = c;
+                    break;
+                }
+            }
+        }
+
+        if (color >= 0) {
+            for (auto var : m_block_vars) {
+                if (var && var->IsActive())
+                    m_var_colors[var->GetOffset()] |= (uint64_t(1) << color);
+            }
+            num_colors = std::max(num_colors, color + 1);
+        }
+
+        m_all_blocks.push_back(block);
+        m_block_color.push_back(color);
+    }
+
+    // 2)  Sort blocks by color (counting sort, preserving the original order within each color).
+    //     Uncolored blocks are placed in the last (sequential) group.
+    m_color_start.assign(num_colors + 2, 0);
+    for (auto color : m_block_color)
+        m_color_start[(color >= 0 ? color : num_colors) + 1]++;
+    for (int c = 0; c <= num_colors; c++)
+        m_color_start[c + 1] += m_color_start[c];
+
+    m_blocks.resize(m_all_blocks.size());
+    std::vector<unsigned int> next(m_color_start.begin(), m_color_start.end() - 1);
+    for (size_t ib = 0; ib < m_all_blocks.size(); ib++) {
+        int color = m_block_color[ib] >= 0 ? m_block_color[ib] : num_colors;
+        m_blocks[next[color]++] = m_all_blocks[ib];
+    }
+}
+
+}  // end namespace chrono
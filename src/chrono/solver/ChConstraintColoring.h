@@ -0,0 +1,81 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONSTRAINT_COLORING_H
+#define CH_CONSTRAINT_COLORING_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Partition of the active constraints of a system descriptor into colors.
+/// Constraints are first grouped in blocks which must be processed together by a projected Gauss-Seidel sweep (a
+/// triplet of friction constraints or a single unilateral or bilateral constraint). Blocks are then assigned colors
+/// with a greedy algorithm, such that no two blocks with the same color reference a common active ChVariables object.
+/// The blocks in a given color can therefore be processed concurrently, while colors are processed in sequence.
+/// Blocks that cannot be colored (because their constraints do not report the referenced variables or because the
+/// maximum number of colors was exceeded) are collected in a final, sequential group.
+class ChApi ChConstraintColoring {
+  public:
+    /// A block of consecutive constraints in the descriptor.
+    struct Block {
+        unsigned int start;  ///< index of first constraint in block
+        unsigned int size;   ///< number of constraints in block (3 for friction triplets, 1 otherwise)
+    };
+
+    /// Maximum number of colors. Blocks which would require more colors are processed sequentially.
+    static const int MAX_COLORS = 64;
+
+    ChConstraintColoring() : m_color_start({0, 0}) {}
+
+    /// Partition the active constraints in the given descriptor into blocks and color them.
+    /// The descriptor variables are assumed to have up-to-date offsets.
+    void Update(ChSystemDescriptor& sysd);
+
+    /// Return the number of colors (excluding the sequential group).
+    unsigned int GetNumColors() const { return (unsigned int)m_color_start.size() - 2; }
+
+    /// Return the index of the first block with the specified color.
+    /// The blocks with color 'c' are those with indices in [GetColorStart(c), GetColorStart(c+1)). A color index equal
+    /// to GetNumColors() refers to the final sequential group.
+    unsigned int GetColorStart(unsigned int color) const { return m_color_start[color]; }
+
+    /// Return the list of blocks, sorted by color.
+    const std::vector<Block>& GetBlocks() const { return m_blocks; }
+
+    /// Return the number of blocks in the final sequential group.
+    unsigned int GetNumSequentialBlocks() const {
+        return m_color_start[GetNumColors() + 1] - m_color_start[GetNumColors()];
+    }
+
+  private:
+    std::vector<Block> m_blocks;              ///< blocks, sorted by color
+    std::vector<unsigned int> m_color_start;  ///< start of each color in the block list (plus sequential group and end)
+
+    // Scratch data, kept to avoid reallocations
+    std::vector<Block> m_all_blocks;
+    std::vector<int> m_block_color;
+    std::vector<uint64_t> m_var_colors;
+    std::vector<ChVariables*> m_block_vars;
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
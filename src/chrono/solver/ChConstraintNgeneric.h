@@ -91,6 +91,25 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
                                              unsigned int start_row,
                                              unsigned int start_col) const override;
 
+    /// Append to the given list the variables referenced by this constraint.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+        return true;
+    }
+
+    /// Append the entries of the constraint Jacobian to the given vector.
+    virtual void GatherJacobian(std::vector<double>& data) const override {
+        for (const auto& Cq_n : Cq)
+            GatherJacobianBlock(data, Cq_n);
+    }
+
+    /// Set the entries of the constraint Jacobian saved with GatherJacobian, reading from the given position.
+    virtual size_t ScatterJacobian(const std::vector<double>& data, size_t pos) override {
+        for (auto& Cq_n : Cq)
+            pos = ScatterJacobianBlock(data, pos, Cq_n);
+        return pos;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -122,6 +122,19 @@ class ChConstraintTuple_1vars {
         if (variables->IsActive())
             PasteMatrix(mat, Cq.transpose(), variables->GetOffset() + start_row, start_col);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables);
+    }
+
+    void GatherJacobian(std::vector<double>& data) const {
+        ChConstraint::GatherJacobianBlock(data, Cq);
+    }
+
+    size_t ScatterJacobian(const std::vector<double>& data, size_t pos) {
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq);
+        return pos;
+    }
 };
 
 /// Case of tuple with reference to 2 ChVariable objects:
@@ -263,6 +276,22 @@ class ChConstraintTuple_2vars {
         if (variables_2->IsActive())
             PasteMatrix(mat, Cq_2.transpose(), variables_2->GetOffset() + start_row, start_col);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+    }
+
+    void GatherJacobian(std::vector<double>& data) const {
+        ChConstraint::GatherJacobianBlock(data, Cq_1);
+        ChConstraint::GatherJacobianBlock(data, Cq_2);
+    }
+
+    size_t ScatterJacobian(const std::vector<double>& data, size_t pos) {
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_1);
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_2);
+        return pos;
+    }
 };
 
 /// Case of tuple with reference to 3 ChVariable objects:
@@ -444,6 +473,25 @@ class ChConstraintTuple_3vars {
         if (variables_3->IsActive())
             PasteMatrix(mat, Cq_3.transpose(), variables_3->GetOffset() + start_row, start_col);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+    }
+
+    void GatherJacobian(std::vector<double>& data) const {
+        ChConstraint::GatherJacobianBlock(data, Cq_1);
+        ChConstraint::GatherJacobianBlock(data, Cq_2);
+        ChConstraint::GatherJacobianBlock(data, Cq_3);
+    }
+
+    size_t ScatterJacobian(const std::vector<double>& data, size_t pos) {
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_1);
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_2);
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_3);
+        return pos;
+    }
 };
 
 /// Case of tuple with reference to 4 ChVariable objects:
@@ -666,6 +714,28 @@ class ChConstraintTuple_4vars {
         if (variables_4->IsActive())
             PasteMatrix(mat, Cq_4.transpose(), variables_4->GetOffset() + start_row, start_col);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) const {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+        vars.push_back(variables_4);
+    }
+
+    void GatherJacobian(std::vector<double>& data) const {
+        ChConstraint::GatherJacobianBlock(data, Cq_1);
+        ChConstraint::GatherJacobianBlock(data, Cq_2);
+        ChConstraint::GatherJacobianBlock(data, Cq_3);
+        ChConstraint::GatherJacobianBlock(data, Cq_4);
+    }
+
+    size_t ScatterJacobian(const std::vector<double>& data, size_t pos) {
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_1);
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_2);
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_3);
+        pos = ChConstraint::ScatterJacobianBlock(data, pos, Cq_4);
+        return pos;
+    }
 };
 
 /// This is a set of 'helper' classes that make easier to manage the templated
@@ -92,6 +92,19 @@ class ChApi ChConstraintTwoBodies : public ChConstraintTwo {
                                              unsigned int start_row,
                                              unsigned int start_col) const override;
 
+    /// Append the entries of the constraint Jacobian to the given vector.
+    virtual void GatherJacobian(std::vector<double>& data) const override {
+        GatherJacobianBlock(data, Cq_a);
+        GatherJacobianBlock(data, Cq_b);
+    }
+
+    /// Set the entries of the constraint Jacobian saved with GatherJacobian, reading from the given position.
+    virtual size_t ScatterJacobian(const std::vector<double>& data, size_t pos) override {
+        pos = ScatterJacobianBlock(data, pos, Cq_a);
+        pos = ScatterJacobianBlock(data, pos, Cq_b);
+        return pos;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -120,6 +120,25 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.PasteJacobianTransposedInto(mat, start_row, start_col);
         tuple_b.PasteJacobianTransposedInto(mat, start_row, start_col);
     }
+
+    /// Append to the given list the variables referenced by this constraint.
+    virtual bool AppendVariables(std::vector<ChVariables*>& vars) const override {
+        tuple_a.AppendVariables(vars);
+        tuple_b.AppendVariables(vars);
+        return true;
+    }
+
+    /// Append the entries of the constraint Jacobian to the given vector.
+    virtual void GatherJacobian(std::vector<double>& data) const override {
+        tuple_a.GatherJacobian(data);
+        tuple_b.GatherJacobian(data);
+    }
+
+    /// Set the entries of the constraint Jacobian saved with GatherJacobian, reading from the given position.
+    virtual size_t ScatterJacobian(const std::vector<double>& data, size_t pos) override {
+        pos = tuple_a.ScatterJacobian(data, pos);
+        return tuple_b.ScatterJacobian(data, pos);
+    }
 };
 
 }  // end namespace chrono
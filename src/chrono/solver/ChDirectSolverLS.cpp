@@ -14,8 +14,6 @@
 
 #include <iomanip>
 
-#include "chrono/core/ChSparsityPatternLearner.h"
-
 #include "chrono/solver/ChDirectSolverLS.h"
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
@@ -33,11 +31,29 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analyze_call(0),
+      m_reuse_symbolic(true),
+      m_symbolic_valid(false),
+      m_symbolic_hash(0) {}
+
+void ChDirectSolverLS::CopySettings(const ChDirectSolverLS& other) {
+    verbose = other.verbose;
+    m_lock = other.m_lock;
+    m_use_learner = other.m_use_learner;
+    m_sparsity = other.m_sparsity;
+    m_use_perm = other.m_use_perm;
+    m_use_rhs_sparsity = other.m_use_rhs_sparsity;
+    m_reuse_symbolic = other.m_reuse_symbolic;
+    SetMatrixSymmetryType(other.m_symmetry);
+    EnableNullPivotDetection(other.m_null_pivot_detection);
+}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
+    m_timer_setup_symbolic.reset();
+    m_timer_setup_numeric.reset();
     m_timer_solve_assembly.reset();
     m_timer_solve_solvercall.reset();
 }
@@ -70,9 +86,16 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
     }
 
     if (call_learner) {
+        // Learn the sparsity pattern, reusing the unchanged rows of the cached pattern.
+        // Reset the matrix structure only if the pattern changed. The learner pass does not touch the cached KRM
+        // scatter locations of the descriptor, which therefore remain valid as long as the matrix structure is kept.
         ChSparsityPatternLearner sparsity_pattern(m_dim, m_dim);
-        sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
-        sparsity_pattern.Apply(m_mat);
+        sysd.BuildSystemMatrixPattern(sparsity_pattern);
+        sparsity_pattern.Learn(m_pattern);
+        if (!m_pattern.Matches(m_mat))
+            m_pattern.Apply(m_mat);
+        if (verbose)
+            std::cout << "  updated rows:   " << m_pattern.GetNumUpdatedInnerVectors() << std::endl;
         m_force_update = false;
     } else if (call_reserve) {
         double density = (m_sparsity > 0) ? 1 - m_sparsity : 1 - SPM_DEF_SPARSITY;
@@ -93,7 +116,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     // Let the concrete solver perform the facorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (write_matrix)
@@ -103,8 +126,9 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                   << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s\n"
+                  << "    symbolic:        " << m_timer_setup_symbolic.GetTimeSeconds() << "s\n"
+                  << "    numeric:         " << m_timer_setup_numeric.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -169,15 +193,16 @@ bool ChDirectSolverLS::SetupCurrent() {
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
         std::cout << " Solver SetupCurrent() [" << m_setup_call << "] n = " << m_dim
                   << "  nnz = " << (int)m_mat.nonZeros() << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s\n"
+                  << "    symbolic:        " << m_timer_setup_symbolic.GetTimeSeconds() << "s\n"
+                  << "    numeric:         " << m_timer_setup_numeric.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -222,6 +247,57 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+// Hash of the structure (dimensions and index arrays) of a compressed sparse matrix.
+static uint64_t HashMatrixStructure(const ChSparseMatrix& mat) {
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](uint64_t val) { hash = (hash ^ val) * 1099511628211ULL; };
+
+    mix((uint64_t)mat.rows());
+    mix((uint64_t)mat.cols());
+    mix((uint64_t)mat.nonZeros());
+    const int* outer = mat.outerIndexPtr();
+    for (ChSparseMatrix::Index i = 0; i <= mat.outerSize(); i++)
+        mix((uint64_t)outer[i]);
+    const int* inner = mat.innerIndexPtr();
+    for (ChSparseMatrix::Index i = 0; i < mat.nonZeros(); i++)
+        mix((uint64_t)inner[i]);
+
+    return hash;
+}
+
+bool ChDirectSolverLS::Factorize() {
+    // Solvers without separate phases perform a complete factorization at each call
+    if (!SupportsSymbolicReuse()) {
+        m_timer_setup_numeric.start();
+        bool result = FactorizeMatrix();
+        m_timer_setup_numeric.stop();
+        m_analyze_call++;
+        return result;
+    }
+
+    // Perform the symbolic analysis only if the matrix structure changed since the last analysis
+    uint64_t hash = m_reuse_symbolic ? HashMatrixStructure(m_mat) : 0;
+    if (!m_reuse_symbolic || !m_symbolic_valid || hash != m_symbolic_hash) {
+        m_timer_setup_symbolic.start();
+        m_symbolic_valid = AnalyzeMatrix();
+        m_timer_setup_symbolic.stop();
+        m_symbolic_hash = hash;
+        m_analyze_call++;
+        if (!m_symbolic_valid)
+            return false;
+    }
+
+    m_timer_setup_numeric.start();
+    bool result = FactorizeMatrixNumeric();
+    m_timer_setup_numeric.stop();
+
+    // Force a new symbolic analysis after a failed factorization
+    if (!result)
+        m_symbolic_valid = false;
+
+    return result;
+}
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     std::ofstream file(filename);
     file << std::setprecision(12) << std::scientific;
@@ -279,6 +355,16 @@ bool ChSolverSparseLU::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseLU::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
+bool ChSolverSparseLU::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseLU::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -308,6 +394,16 @@ bool ChSolverSparseQR::FactorizeMatrix() {
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverSparseQR::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
+bool ChSolverSparseQR::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverSparseQR::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -15,7 +15,10 @@
 #ifndef CH_DIRECTSOLVER_LS_H
 #define CH_DIRECTSOLVER_LS_H
 
+#include <cstdint>
+
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
 
@@ -87,6 +90,13 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Disable for smaller problems where the overhead may be too large.
     void UseSparsityPatternLearner(bool val) { m_use_learner = val; }
 
+    /// Enable/disable reuse of the symbolic factorization (default: enabled).\n
+    /// If enabled, the symbolic analysis of the problem matrix (fill-reducing ordering, elimination tree, etc.) is
+    /// performed only when the matrix sparsity pattern changes; otherwise only the numeric factorization is performed.
+    /// A change in the pattern is detected from a hash of the compressed matrix structure. This option has no effect
+    /// for concrete solvers which do not support separate symbolic and numeric factorization phases.
+    void ReuseSymbolicFactorization(bool val) { m_reuse_symbolic = val; }
+
     /// Force a call to the sparsity pattern learner to update sparsity pattern on the underlying matrix.\n
     /// Such a call may be needed in a situation where the sparsity pattern is locked, but a change in the problem size
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
@@ -122,15 +132,27 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+    /// Get cumulative time for the symbolic analysis in Setup phase (included in GetTimeSetup_SolverCall).
+    /// Always zero for solvers which do not support separate symbolic and numeric factorization phases.
+    double GetTimeSetup_SolverCallSymbolic() const { return m_timer_setup_symbolic(); }
+    /// Get cumulative time for the numeric factorization in Setup phase (included in GetTimeSetup_SolverCall).
+    double GetTimeSetup_SolverCallNumeric() const { return m_timer_setup_numeric(); }
 
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses performed during calls to the solver's Setup function.
+    unsigned int GetNumSymbolicAnalyses() const { return m_analyze_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
 
+    /// Get the sparsity pattern extracted during the last call to the sparsity pattern learner.
+    /// This pattern is cached and reused by subsequent learning passes: only rows with a different sequence of
+    /// insertions are processed again, and the matrix structure is reset only if the pattern changed.
+    const ChSparsityPattern& GetSparsityPattern() const { return m_pattern; }
+
     /// Get shortcut handle to underlying A matrix, for A*x=b
     ChSparseMatrix& A() { return m_mat; }
 
@@ -163,6 +185,11 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Call x() afterward to get results.
     virtual double SolveCurrent();
 
+    /// Create a new direct solver of the same type, with the same settings but without matrix or factorization.
+    /// This allows keeping several factorizations at once (e.g., see ChSolverADMM). Return nullptr if not supported
+    /// by the concrete solver.
+    virtual ChDirectSolverLS* Clone() const { return nullptr; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -172,6 +199,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
   protected:
     ChDirectSolverLS();
 
+    /// Copy the solver settings (but not the matrix, vectors, factorization, or statistics) from another solver.
+    void CopySettings(const ChDirectSolverLS& other);
+
     virtual bool IsIterative() const override { return false; }
     virtual bool IsDirect() const override { return true; }
     virtual ChDirectSolverLS* AsDirect() override { return this; }
@@ -179,6 +209,18 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
+    /// Indicate whether or not the concrete solver supports separate symbolic and numeric factorization phases.
+    /// A solver which returns true must override #AnalyzeMatrix and #FactorizeMatrixNumeric.
+    virtual bool SupportsSymbolicReuse() const { return false; }
+
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    /// Only called if #SupportsSymbolicReuse returns true.
+    virtual bool AnalyzeMatrix() { return true; }
+
+    /// Perform the numeric factorization of the current sparse matrix, reusing the last symbolic analysis, and return
+    /// true if successful. Only called if #SupportsSymbolicReuse returns true.
+    virtual bool FactorizeMatrixNumeric() { return FactorizeMatrix(); }
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() = 0;
@@ -192,6 +234,7 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     virtual bool SolveRequiresMatrix() const override { return false; }
 
     ChSparseMatrix m_mat;           ///< problem matrix
+    ChSparsityPattern m_pattern;    ///< cached sparsity pattern (from the last learning pass)
     int m_dim;                      ///< problem size
     MatrixSymmetryType m_symmetry;  ///< symmetry of problem matrix
     double m_sparsity;              ///< user-supplied estimate of matrix sparsity
@@ -201,6 +244,8 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     unsigned int m_solve_call;  ///< counter for calls to Solve
     unsigned int m_setup_call;  ///< counter for calls to Setup
 
+    unsigned int m_analyze_call;  ///< counter for symbolic analyses
+
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
@@ -209,12 +254,21 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
+    bool m_reuse_symbolic;        ///< reuse the symbolic factorization if the pattern is unchanged?
+    bool m_symbolic_valid;        ///< is there a valid symbolic factorization?
+    uint64_t m_symbolic_hash;     ///< hash of the matrix structure used for the last symbolic analysis
+
     ChTimer m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer m_timer_setup_solvercall;  ///< timer for factorization
+    ChTimer m_timer_setup_symbolic;    ///< timer for symbolic analysis
+    ChTimer m_timer_setup_numeric;     ///< timer for numeric factorization
     ChTimer m_timer_solve_assembly;    ///< timer for RHS assembly
     ChTimer m_timer_solve_solvercall;  ///< timer for solution
 
   private:
+    /// Factorize the current matrix, reusing the symbolic analysis if possible and enabled.
+    bool Factorize();
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -231,10 +285,25 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     ~ChSolverSparseLU() {}
     virtual Type GetType() const override { return Type::SPARSE_LU; }
 
+    virtual ChSolverSparseLU* Clone() const override {
+        auto solver = new ChSolverSparseLU();
+        solver->CopySettings(*this);
+        return solver;
+    }
+
   private:
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Symbolic analysis and numeric factorization can be performed separately.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Perform the numeric factorization of the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -256,10 +325,25 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     ~ChSolverSparseQR() {}
     virtual Type GetType() const override { return Type::SPARSE_QR; }
 
+    virtual ChSolverSparseQR* Clone() const override {
+        auto solver = new ChSolverSparseQR();
+        solver->CopySettings(*this);
+        return solver;
+    }
+
   private:
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Symbolic analysis and numeric factorization can be performed separately.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Perform the numeric factorization of the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -53,6 +53,11 @@ class ChApi ChDirectSolverLScomplex {
     /// Solve linear system.
     virtual double Solve(const ChVectorDynamic<std::complex<double>>& b);
 
+    /// Create a new direct solver of the same type, with the same settings but without matrix or factorization.
+    /// This allows several factorizations to be used concurrently (e.g., see modal::Solve). Return nullptr if not
+    /// supported by the concrete solver.
+    virtual ChDirectSolverLScomplex* Clone() const { return nullptr; }
+
     bool verbose = false;
 
   protected:
@@ -85,6 +90,12 @@ class ChApi ChSolverSparseComplexLU : public ChDirectSolverLScomplex {
     ChSolverSparseComplexLU() {}
     ~ChSolverSparseComplexLU() {}
 
+    virtual ChSolverSparseComplexLU* Clone() const override {
+        auto solver = new ChSolverSparseComplexLU();
+        solver->verbose = verbose;
+        return solver;
+    }
+
   private:
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
@@ -110,6 +121,12 @@ class ChApi ChSolverSparseComplexQR : public ChDirectSolverLScomplex {
     ChSolverSparseComplexQR() {}
     ~ChSolverSparseComplexQR() {}
 
+    virtual ChSolverSparseComplexQR* Clone() const override {
+        auto solver = new ChSolverSparseComplexQR();
+        solver->verbose = verbose;
+        return solver;
+    }
+
   private:
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
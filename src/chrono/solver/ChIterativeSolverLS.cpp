@@ -216,6 +216,9 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
+    // Pack the constraint Jacobians (if sparse products are enabled)
+    sysd.SetupSparseProducts();
+
     // Assemble the problem right-hand side vector
     sysd.BuildSystemMatrix(nullptr, &m_rhs);
 
@@ -12,6 +12,9 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/solver/ChIterativeSolverVI.h"
 
 namespace chrono {
@@ -61,6 +64,91 @@ void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalamb
     dlambda_history[iternum] = mdeltalambda;
 }
 
+// Projected SOR update of a block of constraints (a friction triplet n,u,v or a single constraint).
+// Return the constraint violation for the block and the maximum change in the block Lagrange multipliers.
+static void UpdateBlock(ChConstraint** block,
+                        unsigned int size,
+                        double omega,
+                        double shlambda,
+                        double& violation,
+                        double& deltalambda) {
+    double old_lambda[3];
+    double residual[3];
+
+    // compute residuals c_i = [Cq_i]*q + b_i + cfm_i*l_i and update lambda += delta_lambda,
+    // with delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    for (unsigned int k = 0; k < size; k++) {
+        residual[k] = block[k]->ComputeJacobianTimesState() + block[k]->GetRightHandSide() +
+                      block[k]->GetComplianceTerm() * block[k]->GetLagrangeMultiplier();
+        old_lambda[k] = block[k]->GetLagrangeMultiplier();
+        block[k]->SetLagrangeMultiplier(old_lambda[k] - (omega / block[k]->GetSchurComplement()) * residual[k]);
+    }
+
+    // project onto the admissible set (for friction triplets, the N normal component will take care of N,U,V)
+    block[0]->Project();
+
+    if (size == 3)
+        violation = std::abs(std::min(0.0, residual[0]));
+    else
+        violation = std::abs(block[0]->Violation(residual[0]));
+
+    deltalambda = 0;
+    for (unsigned int k = 0; k < size; k++) {
+        double new_lambda = block[k]->GetLagrangeMultiplier();
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (shlambda != 1.0) {
+            new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda[k];
+            block[k]->SetLagrangeMultiplier(new_lambda);
+        }
+        double true_delta = new_lambda - old_lambda[k];
+        block[k]->IncrementState(true_delta);
+        deltalambda = std::max(deltalambda, std::abs(true_delta));
+    }
+}
+
+double ChIterativeSolverVI::SweepColors(std::vector<ChConstraint*>& constraints,
+                                        const ChConstraintColoring& coloring,
+                                        bool forward,
+                                        int nthreads,
+                                        double& maxdeltalambda) {
+    const auto& blocks = coloring.GetBlocks();
+    const int num_blocks = (int)blocks.size();
+    const int num_groups = (int)coloring.GetNumColors() + 1;
+
+    m_block_violation.resize(num_blocks);
+    m_block_deltalambda.resize(num_blocks);
+
+    for (int ig = 0; ig < num_groups; ig++) {
+        int color = forward ? ig : num_groups - 1 - ig;
+        int start = (int)coloring.GetColorStart(color);
+        int end = (int)coloring.GetColorStart(color + 1);
+        if (color == num_groups - 1) {
+            // blocks in the final group may conflict with each other and must be processed sequentially
+            for (int i = 0; i < end - start; i++) {
+                int ib = forward ? start + i : end - 1 - i;
+                UpdateBlock(&constraints[blocks[ib].start], blocks[ib].size, m_omega, m_shlambda,
+                            m_block_violation[ib], m_block_deltalambda[ib]);
+            }
+        } else {
+            // blocks with the same color do not share any active variables
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (end - start > 2 * nthreads)
+            for (int ib = start; ib < end; ib++) {
+                UpdateBlock(&constraints[blocks[ib].start], blocks[ib].size, m_omega, m_shlambda,
+                            m_block_violation[ib], m_block_deltalambda[ib]);
+            }
+        }
+    }
+
+    double maxviolation = 0;
+    maxdeltalambda = 0;
+    for (int ib = 0; ib < num_blocks; ib++) {
+        maxviolation = std::max(maxviolation, m_block_violation[ib]);
+        maxdeltalambda = std::max(maxdeltalambda, m_block_deltalambda[ib]);
+    }
+
+    return maxviolation;
+}
+
 void ChIterativeSolverVI::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChIterativeSolverVI>();
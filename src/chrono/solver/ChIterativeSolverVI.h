@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChSolverVI.h"
 #include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChConstraintColoring.h"
 
 namespace chrono {
 
@@ -110,6 +111,16 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note: 'iternum' starts at 0 for the first iteration.
     void AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum);
 
+    /// Perform one projected SOR sweep over the constraint blocks of the given coloring.
+    /// Colors are processed in sequence (in forward or reverse order) and the blocks within a color are processed in
+    /// parallel, using the specified number of threads. The result does not depend on the number of threads.
+    /// Return the maximum constraint violation and, in 'maxdeltalambda', the maximum change in Lagrange multipliers.
+    double SweepColors(std::vector<ChConstraint*>& constraints,
+                       const ChConstraintColoring& coloring,
+                       bool forward,
+                       int nthreads,
+                       double& maxdeltalambda);
+
   protected:
     /// Indicate whether ot not the Solve() phase requires an up-to-date problem matrix.
     /// Typically, this is the case for iterative solvers (as the matrix is needed for
@@ -123,6 +134,10 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     bool record_violation_history;
     std::vector<double> violation_history;
     std::vector<double> dlambda_history;
+
+  private:
+    std::vector<double> m_block_violation;    ///< per-block constraint violation (colored sweeps)
+    std::vector<double> m_block_deltalambda;  ///< per-block change in Lagrange multipliers (colored sweeps)
 };
 
 /// @} chrono_solver
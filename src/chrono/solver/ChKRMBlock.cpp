@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cassert>
+
 #include "chrono/solver/ChKRMBlock.h"
 
 namespace chrono {
@@ -126,4 +129,72 @@ void ChKRMBlock::PasteMatrixInto(ChSparseMatrix& mat,
     }
 }
 
+bool ChKRMBlock::ComputeScatterIndices(const ChSparseMatrix& mat,
+                                       unsigned int start_row,
+                                       unsigned int start_col,
+                                       std::vector<int>& indices) const {
+    assert(mat.isCompressed());
+
+    indices.clear();
+    if (KRM.rows() == 0)
+        return true;
+
+    const int* outer = mat.outerIndexPtr();
+    const int* inner = mat.innerIndexPtr();
+
+    for (unsigned int iv = 0; iv < GetNumVariables(); iv++) {
+        unsigned int io = GetVariable(iv)->GetOffset();
+        unsigned int in = GetVariable(iv)->GetDOF();
+        if (!GetVariable(iv)->IsActive())
+            continue;
+
+        for (unsigned int r = 0; r < in; r++) {
+            const int* row_begin = inner + outer[io + start_row + r];
+            const int* row_end = inner + outer[io + start_row + r + 1];
+
+            for (unsigned int jv = 0; jv < GetNumVariables(); jv++) {
+                unsigned int jo = GetVariable(jv)->GetOffset();
+                unsigned int jn = GetVariable(jv)->GetDOF();
+                if (!GetVariable(jv)->IsActive())
+                    continue;
+
+                for (unsigned int c = 0; c < jn; c++) {
+                    int col = (int)(jo + start_col + c);
+                    const int* pos = std::lower_bound(row_begin, row_end, col);
+                    if (pos == row_end || *pos != col)
+                        return false;
+                    indices.push_back((int)(pos - inner));
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+void ChKRMBlock::ScatterMatrixInto(double* values, const std::vector<int>& indices) const {
+    if (KRM.rows() == 0)
+        return;
+
+    size_t k = 0;
+    unsigned int kio = 0;
+    for (unsigned int iv = 0; iv < GetNumVariables(); iv++) {
+        unsigned int in = GetVariable(iv)->GetDOF();
+        if (GetVariable(iv)->IsActive()) {
+            for (unsigned int r = 0; r < in; r++) {
+                unsigned int kjo = 0;
+                for (unsigned int jv = 0; jv < GetNumVariables(); jv++) {
+                    unsigned int jn = GetVariable(jv)->GetDOF();
+                    if (GetVariable(jv)->IsActive()) {
+                        for (unsigned int c = 0; c < jn; c++)
+                            values[indices[k++]] += KRM(kio + r, kjo + c);
+                    }
+                    kjo += jn;
+                }
+            }
+        }
+        kio += in;
+    }
+}
+
 }  // end namespace chrono
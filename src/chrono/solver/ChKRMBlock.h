@@ -74,6 +74,19 @@ class ChApi ChKRMBlock {
                          unsigned int start_col,
                          bool overwrite) const;
 
+    /// Compute the locations, in the value array of the given compressed (row-major) sparse matrix, of all entries of
+    /// the KRM matrix corresponding to active variables (with the same offset conventions as PasteMatrixInto).
+    /// Return false if any of these entries is not present in the sparsity pattern of the global matrix.
+    bool ComputeScatterIndices(const ChSparseMatrix& mat,
+                               unsigned int start_row,
+                               unsigned int start_col,
+                               std::vector<int>& indices) const;
+
+    /// Add the KRM matrix into the value array of a compressed sparse matrix, at the locations precomputed with
+    /// ComputeScatterIndices. This is a fast alternative to PasteMatrixInto (with overwrite=false) for matrices with
+    /// a fixed sparsity pattern.
+    void ScatterMatrixInto(double* values, const std::vector<int>& indices) const;
+
   private:
     ChMatrixDynamic<double> KRM;
     std::vector<ChVariables*> variables;
@@ -16,6 +16,9 @@
 
 #include "chrono/solver/ChSolverADMM.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
@@ -34,7 +37,10 @@ ChSolverADMM::ChSolverADMM()
       stepadjust_type(AdmmStepType::BALANCED_FAST),
       tol_prim(1e-6),
       tol_dual(1e-6),
-      acceleration(AdmmAcceleration::BASIC) {
+      acceleration(AdmmAcceleration::BASIC),
+      m_cache_size(0),
+      m_cache_clock(0),
+      m_num_factorizations(0) {
     LS_solver = chrono_types::make_shared<ChSolverSparseQR>();
 }
 
@@ -81,7 +87,7 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
         // much faster to fill brand new sparse matrices??!!
 
         ChSparsityPatternLearner sparsity_pattern(nv, nv);
-        sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
+        sysd.BuildSystemMatrixPattern(sparsity_pattern);
         sparsity_pattern.Apply(H);
         sysd.BuildSystemMatrix(&H, &k);
         LS_solver->A() = H;
@@ -122,7 +128,12 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     ChVectorDynamic<> z_old(nc);
     ChVectorDynamic<> y_old(nc);
 
-    sysd.PasteConstraintsJacobianMatrixInto(Cq);
+    if (sysd.UseSparseProducts()) {
+        sysd.SetupSparseProducts();
+        Cq = sysd.GetPackedJacobian();
+    } else {
+        sysd.PasteConstraintsJacobianMatrixInto(Cq);
+    }
     sysd.PasteComplianceMatrixInto(E);
     sysd.BuildFbVector(k);
     sysd.BuildBiVector(b);
@@ -241,7 +252,7 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     // sysd.BuildSystemMatrix(&LS_solver->A(),&LS_solver->b());  // A = [M, Cq'; Cq, E ];
     // much faster to fill brand new sparse matrices??!!
     ChSparsityPatternLearner sparsity_pattern(nv + nc, nv + nc);
-    sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
+    sysd.BuildSystemMatrixPattern(sparsity_pattern);
     sparsity_pattern.Apply(A);
 
     sysd.BuildSystemMatrix(&A, &B);  // A = [M, Cq'; Cq, E ];
@@ -269,6 +280,13 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     m_timer_factorize.start();
 
     LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    m_num_factorizations = 1;
+
+    // Current factorization (when caching, the first one is kept by the main direct solver)
+    ChDirectSolverLS* ls_solver = LS_solver.get();
+    int rho_level = 0;
+    if (m_cache_size > 1)
+        ResetFactorizationCache();
 
     m_timer_factorize.stop();
     if (verbose)
@@ -300,19 +318,19 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
         // ckkt = -bkkt + (vsigma+vrho).*z - y;
 
         ChVectorDynamic<> ckkt = -b + (vsigma + vrho).cwiseProduct(z) - y;
-        LS_solver->b() << k, ckkt;  // B = [k;ckkt];
+        ls_solver->b() << k, ckkt;  // B = [k;ckkt];
 
         m_timer_solve.start();
 
-        LS_solver->SolveCurrent();  // LU forward/backsolve ++++++++++++++++++++++++++++++++++++++
+        ls_solver->SolveCurrent();  // LU forward/backsolve ++++++++++++++++++++++++++++++++++++++
 
         m_timer_solve.stop();
         if (verbose)
             std::cout << " Time for solve : << " << m_timer_solve.GetTimeSeconds() << "s" << std::endl;
 
         // x = dA\B;      // A* x = B  with x = [v, -l]
-        l = -LS_solver->x().block(nv, 0, nc, 1);
-        v = LS_solver->x().block(0, 0, nv, 1);
+        l = -ls_solver->x().block(nv, 0, nc, 1);
+        v = ls_solver->x().block(0, 0, nv, 1);
 
         // Z
 
@@ -409,13 +427,20 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
                 ChTimer m_timer_refactorize;
                 m_timer_refactorize.start();
 
-                // Avoid rebuilding all sparse matrix:
-                // A) just remove old rho with -= :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho(i));
-
-                // Update rho
-                rho_i = rho_i * rhofactor;
+                if (m_cache_size > 1) {
+                    // Update rho, restricted to a geometric sequence so that factorizations can be reused
+                    double ratio = std::max(this->stepadjust_threshold, 1.01);
+                    rho_level += (int)std::lround(std::log(rhofactor) / std::log(ratio));
+                    rho_i = this->rho * std::pow(ratio, rho_level);
+                } else {
+                    // Avoid rebuilding all sparse matrix:
+                    // A) just remove old rho with -= :
+                    for (int i = 0; i < nc; ++i)
+                        ls_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho(i));
+
+                    // Update rho
+                    rho_i = rho_i * rhofactor;
+                }
 
                 // vrho(fric == -2) = rho_b; //  special step for bilateral joints
                 vrho.setConstant(rho_i);
@@ -432,12 +457,18 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
                 //
                 //  A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ];
                 //
-                // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now:
-                // B) add old rho with += :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
-
-                LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                if (m_cache_size > 1) {
+                    // Reuse the factorization for this rho, if cached
+                    ls_solver = GetFactorization(A, vrho, nv, rho_level, ls_solver);
+                } else {
+                    // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now:
+                    // B) add old rho with += :
+                    for (int i = 0; i < nc; ++i)
+                        ls_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
+
+                    ls_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                    m_num_factorizations++;
+                }
 
                 m_timer_refactorize.stop();
                 if (verbose)
@@ -492,7 +523,7 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
         m_timer_convert.start();
 
         ChSparsityPatternLearner sparsity_pattern(nv, nv);
-        sysd.BuildSystemMatrix(&sparsity_pattern, 0);
+        sysd.BuildSystemMatrixPattern(sparsity_pattern);
         sparsity_pattern.Apply(H);
         sysd.BuildSystemMatrix(&H, &k);
         LS_solver->A() = H;
@@ -533,7 +564,12 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     ChVectorDynamic<> y_old(nc);
     ChVectorDynamic<> v_old(nv);
 
-    sysd.PasteConstraintsJacobianMatrixInto(Cq);
+    if (sysd.UseSparseProducts()) {
+        sysd.SetupSparseProducts();
+        Cq = sysd.GetPackedJacobian();
+    } else {
+        sysd.PasteConstraintsJacobianMatrixInto(Cq);
+    }
     sysd.PasteComplianceMatrixInto(E);
     sysd.BuildFbVector(k);
     sysd.BuildBiVector(b);
@@ -654,7 +690,7 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     // sysd.BuildSystemMatrix(&LS_solver->A(),&LS_solver->b());  // A = [M, Cq'; Cq, E ];
     // much faster to fill brand new sparse matrices??!!
     ChSparsityPatternLearner sparsity_pattern(nv + nc, nv + nc);
-    sysd.BuildSystemMatrix(&sparsity_pattern, nullptr);
+    sysd.BuildSystemMatrixPattern(sparsity_pattern);
     sparsity_pattern.Apply(A);
 
     sysd.BuildSystemMatrix(&A, &B);  // A = [M, Cq'; Cq, E ];
@@ -682,6 +718,13 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     m_timer_factorize.start();
 
     LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+    m_num_factorizations = 1;
+
+    // Current factorization (when caching, the first one is kept by the main direct solver)
+    ChDirectSolverLS* ls_solver = LS_solver.get();
+    int rho_level = 0;
+    if (m_cache_size > 1)
+        ResetFactorizationCache();
 
     m_timer_factorize.stop();
     if (verbose)
@@ -717,19 +760,19 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
         // ckkt = -bkkt + (vsigma+vrho).*z - y;
 
         ChVectorDynamic<> ckkt = -b + (vsigma + vrho).cwiseProduct(z) - y;
-        LS_solver->b() << k, ckkt;  // B = [k;ckkt];
+        ls_solver->b() << k, ckkt;  // B = [k;ckkt];
 
         m_timer_solve.start();
 
-        LS_solver->SolveCurrent();  // LU forward/backsolve ++++++++++++++++++++++++++++++++++++++
+        ls_solver->SolveCurrent();  // LU forward/backsolve ++++++++++++++++++++++++++++++++++++++
 
         m_timer_solve.stop();
         if (verbose)
             std::cout << " Time for solve : << " << m_timer_solve.GetTimeSeconds() << "s" << std::endl;
 
         // x = dA\B;      // A* x = B  with x = [v, -l]
-        l = -LS_solver->x().block(nv, 0, nc, 1);
-        v = LS_solver->x().block(0, 0, nv, 1);
+        l = -ls_solver->x().block(nv, 0, nc, 1);
+        v = ls_solver->x().block(0, 0, nv, 1);
 
         // Y
 
@@ -837,13 +880,20 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
                 ChTimer m_timer_refactorize;
                 m_timer_refactorize.start();
 
-                // Avoid rebuilding all sparse matrix:
-                // A) just remove old rho with -= :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho(i));
-
-                // Update rho
-                rho_i = rho_i * rhofactor;
+                if (m_cache_size > 1) {
+                    // Update rho, restricted to a geometric sequence so that factorizations can be reused
+                    double ratio = std::max(this->stepadjust_threshold, 1.01);
+                    rho_level += (int)std::lround(std::log(rhofactor) / std::log(ratio));
+                    rho_i = this->rho * std::pow(ratio, rho_level);
+                } else {
+                    // Avoid rebuilding all sparse matrix:
+                    // A) just remove old rho with -= :
+                    for (int i = 0; i < nc; ++i)
+                        ls_solver->A().coeffRef(nv + i, nv + i) -= -(sigma + vrho(i));
+
+                    // Update rho
+                    rho_i = rho_i * rhofactor;
+                }
 
                 // vrho(fric == -2) = rho_b; //  special step for bilateral joints
                 vrho.setConstant(rho_i);
@@ -860,12 +910,18 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
                 //
                 //  A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ];
                 //
-                // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now:
-                // B) add old rho with += :
-                for (int i = 0; i < nc; ++i)
-                    LS_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
-
-                LS_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                if (m_cache_size > 1) {
+                    // Reuse the factorization for this rho, if cached
+                    ls_solver = GetFactorization(A, vrho, nv, rho_level, ls_solver);
+                } else {
+                    // To avoid rebuilding A, we just removed the rho step from the diagonal in A), and now:
+                    // B) add old rho with += :
+                    for (int i = 0; i < nc; ++i)
+                        ls_solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
+
+                    ls_solver->SetupCurrent();  // LU decomposition ++++++++++++++++++++++++++++++++++++++
+                    m_num_factorizations++;
+                }
 
                 m_timer_refactorize.stop();
                 if (verbose)
@@ -891,6 +947,76 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     return r_dual;
 }
 
+void ChSolverADMM::ResetFactorizationCache() {
+    // Factorizations from a previous solve refer to a different matrix
+    for (auto& entry : m_cache)
+        entry.valid = false;
+
+    // The main direct solver holds the factorization for the initial rho
+    auto main = std::find_if(m_cache.begin(), m_cache.end(),
+                             [this](const CachedFactorization& entry) { return entry.solver == LS_solver; });
+    if (main == m_cache.end()) {
+        m_cache.insert(m_cache.begin(), {LS_solver, 0, 0, false});
+        main = m_cache.begin();
+    }
+    main->level = 0;
+    main->last_use = ++m_cache_clock;
+    main->valid = true;
+
+    // Discard any extra solvers if the cache size was reduced
+    while ((int)m_cache.size() > m_cache_size) {
+        auto last = (m_cache.back().solver == LS_solver) ? m_cache.end() - 2 : m_cache.end() - 1;
+        m_cache.erase(last);
+    }
+}
+
+ChDirectSolverLS* ChSolverADMM::GetFactorization(const ChSparseMatrix& A,
+                                                 const ChVectorDynamic<>& vrho,
+                                                 int nv,
+                                                 int level,
+                                                 ChDirectSolverLS* current) {
+    // Look for a cached factorization with the requested rho
+    for (auto& entry : m_cache) {
+        if (entry.valid && entry.level == level) {
+            entry.last_use = ++m_cache_clock;
+            return entry.solver.get();
+        }
+    }
+
+    // Select the solver for the new factorization: a new instance if the cache is not full (and the direct solver can
+    // be cloned), otherwise the least recently used one, keeping the current factorization if possible
+    CachedFactorization* slot = nullptr;
+    if ((int)m_cache.size() < m_cache_size) {
+        if (auto clone = LS_solver->Clone()) {
+            m_cache.push_back({std::shared_ptr<ChDirectSolverLS>(clone), 0, 0, false});
+            slot = &m_cache.back();
+        }
+    }
+    if (!slot) {
+        for (auto& entry : m_cache) {
+            if (m_cache.size() > 1 && entry.solver.get() == current)
+                continue;
+            if (!slot || !entry.valid || (slot->valid && entry.last_use < slot->last_use))
+                slot = &entry;
+        }
+    }
+
+    // Factorize A = [M, Cq'; Cq, -diag(vsigma+vrho) + E ]
+    auto solver = slot->solver.get();
+    solver->A() = A;
+    for (int i = 0; i < vrho.size(); ++i)
+        solver->A().coeffRef(nv + i, nv + i) += -(sigma + vrho(i));
+    solver->b().resize(A.rows());
+    solver->SetupCurrent();
+    m_num_factorizations++;
+
+    slot->level = level;
+    slot->last_use = ++m_cache_clock;
+    slot->valid = true;
+
+    return solver;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 
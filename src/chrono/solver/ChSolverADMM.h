@@ -94,6 +94,17 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     void SetAcceleration(AdmmAcceleration mr) { acceleration = mr; }
     AdmmAcceleration GetAcceleration() { return acceleration; }
 
+    /// Set the maximum number of factorizations of the KKT matrix kept for different values of rho (default: 0).
+    /// With a value larger than 1, the adapted values of rho are restricted to a geometric sequence (with ratio given
+    /// by the step adjust threshold) and, within a solve, the factorizations for up to this number of rho values are
+    /// kept, so that returning to a previous value of rho does not trigger a new factorization. Additional direct
+    /// solvers are obtained with ChDirectSolverLS::Clone(); if not supported, the factorization is updated in place.
+    void SetFactorizationCacheSize(int num) { m_cache_size = num; }
+    int GetFactorizationCacheSize() const { return m_cache_size; }
+
+    /// Return the number of factorizations of the KKT matrix performed during the last solve.
+    int GetNumFactorizations() const { return m_num_factorizations; }
+
     /// Set the absolute tolerance for the primal residual (force impulses error), if
     /// the iteration falls below this and the dual tolerance, it stops iterating.
     void SetTolerancePrimal(double mr) { tol_prim = mr; }
@@ -138,6 +149,30 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     AdmmAcceleration acceleration;
 
     std::shared_ptr<ChDirectSolverLS> LS_solver;
+
+    /// Factorization of the KKT matrix for a given rho (rho * ratio^level).
+    struct CachedFactorization {
+        std::shared_ptr<ChDirectSolverLS> solver;  ///< direct solver holding the factorization
+        int level;                                 ///< index of rho in the geometric sequence
+        unsigned int last_use;                     ///< time stamp of last use
+        bool valid;                                ///< true if the factorization is for the current KKT matrix
+    };
+
+    int m_cache_size;                          ///< maximum number of cached factorizations
+    std::vector<CachedFactorization> m_cache;  ///< cached factorizations
+    unsigned int m_cache_clock;                ///< time stamp counter
+    int m_num_factorizations;                  ///< number of factorizations in last solve
+
+    /// Invalidate all cached factorizations and register the main direct solver for the initial rho.
+    void ResetFactorizationCache();
+
+    /// Return a direct solver holding the factorization of the KKT matrix for the given rho level.
+    /// A is the KKT matrix without the rho and sigma terms, vrho are the rho values for all constraints.
+    ChDirectSolverLS* GetFactorization(const ChSparseMatrix& A,
+                                       const ChVectorDynamic<>& vrho,
+                                       int nv,
+                                       int level,
+                                       ChDirectSolverLS* current);
     // Eigen::SparseQR<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< Eigen SparseQR solver (do not use
     // SparseLU: it is broken!)
     //  SparseLU: it is broken!)
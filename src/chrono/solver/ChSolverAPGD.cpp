@@ -82,6 +82,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack the constraint Jacobians (if sparse products are enabled)
+    sysd.SetupSparseProducts();
+
     double L, t;
     double theta;
     double thetaNew;
@@ -59,6 +59,9 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack the constraint Jacobians (if sparse products are enabled)
+    sysd.SetupSparseProducts();
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used as diagonal preconditioner.
     int j_friction_comp = 0;
@@ -312,6 +315,9 @@ double ChSolverPMINRES::Solve_SupportingStiffness(ChSystemDescriptor& sysd) {
     ChVectorDynamic<> mtmp(nx);
     ChVectorDynamic<> mDi(nx);
 
+    // Pack the constraint Jacobians (if sparse products are enabled)
+    sysd.SetupSparseProducts();
+
     //
     // --- Compute a diagonal (scaling) preconditioner for the KKT system:
     //
@@ -20,7 +20,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChSolverPSOR)
 CH_UPCASTING(ChSolverPSOR, ChIterativeSolverVI)
 
-ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
+ChSolverPSOR::ChSolverPSOR() : maxviolation(0), m_num_threads(1) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
@@ -34,7 +34,9 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
 
     // 1)  Update auxiliary data in all constraints before starting,
     //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
-    for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
+    const int nConstr = (int)mconstraints.size();
+#pragma omp parallel for schedule(static) num_threads(m_num_threads) if (m_num_threads > 1)
+    for (int ic = 0; ic < nConstr; ic++)
         mconstraints[ic]->Update_auxiliary();
 
     // Average all g_i for the triplet of contact constraints n,u,v.
@@ -58,7 +60,9 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     // 2)  Compute, for all items with variables, the initial guess for
     //     still unconstrained system:
 
-    for (unsigned int iv = 0; iv < mvariables.size(); iv++) {
+    const int nVars = (int)mvariables.size();
+#pragma omp parallel for schedule(static) num_threads(m_num_threads) if (m_num_threads > 1)
+    for (int iv = 0; iv < nVars; iv++) {
         if (mvariables[iv]->IsActive())
             mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());  // q = [M]'*fb
     }
@@ -81,6 +85,25 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     std::fill(violation_history.begin(), violation_history.end(), 0.0);
     std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
 
+    if (m_num_threads > 1) {
+        // Multithreaded sweeps over the colored constraint blocks
+        m_coloring.Update(sysd);
+
+        for (int iter = 0; iter < m_max_iterations; iter++) {
+            maxviolation = SweepColors(mconstraints, m_coloring, true, m_num_threads, maxdeltalambda);
+
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+            m_iterations++;
+
+            if (maxviolation < m_tolerance)
+                break;
+        }
+
+        return maxviolation;
+    }
+
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // The iteration on all constraints
         //
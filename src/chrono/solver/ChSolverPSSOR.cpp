@@ -19,7 +19,7 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPSSOR)
 
-ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0) {}
+ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0), m_num_threads(1) {}
 
 double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
@@ -34,7 +34,8 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
 
     // 1)  Update auxiliary data in all constraints before starting,
     //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
-    for (unsigned int ic = 0; ic < nConstr; ic++)
+#pragma omp parallel for schedule(static) num_threads(m_num_threads) if (m_num_threads > 1)
+    for (int ic = 0; ic < (int)nConstr; ic++)
         mconstraints[ic]->Update_auxiliary();
 
     // Average all g_i for the triplet of contact constraints n,u,v.
@@ -56,7 +57,8 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
 
     // 2)  Compute, for all items with variables, the initial guess for
     //     still unconstrained system:
-    for (unsigned int iv = 0; iv < nVars; iv++)
+#pragma omp parallel for schedule(static) num_threads(m_num_threads) if (m_num_threads > 1)
+    for (int iv = 0; iv < (int)nVars; iv++)
         if (mvariables[iv]->IsActive())
             mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(),
                                                           mvariables[iv]->Force());  // q = [M]'*fb
@@ -77,6 +79,28 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     std::fill(violation_history.begin(), violation_history.end(), 0.0);
     std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
 
+    if (m_num_threads > 1) {
+        // Multithreaded forward and backward sweeps over the colored constraint blocks
+        m_coloring.Update(sysd);
+
+        for (int iter = 0; iter < m_max_iterations;) {
+            maxviolation = SweepColors(mconstraints, m_coloring, true, m_num_threads, maxdeltalambda);
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+            iter++;
+
+            maxviolation = SweepColors(mconstraints, m_coloring, false, m_num_threads, maxdeltalambda);
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+            if (maxviolation < m_tolerance)
+                break;
+            iter++;
+        }
+
+        return maxviolation;
+    }
+
     for (int iter = 0; iter < m_max_iterations;) {
         //
         // Forward sweep, for symmetric SOR
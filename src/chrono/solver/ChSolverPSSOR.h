@@ -49,8 +49,24 @@ CH_DEPRECATED("deprecated. Use ChSolverPSOR, ChSolverBB, or ChSolverAPGD instead
     /// For the PSSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Set the number of threads used for the constraint sweeps (default: 1).
+    /// If more than one thread is used, the active constraints are partitioned in colors (see ChConstraintColoring)
+    /// such that constraints with the same color do not act on common variables. Colors are then processed in sequence
+    /// and the constraints in each color are processed in parallel. This preserves the Gauss-Seidel character of the
+    /// iteration, but the update order (and hence the solution at a given iteration) differs from that of the
+    /// sequential sweep. The solution does not depend on the number of threads, as long as more than one is used.
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(1, num_threads); }
+
+    /// Return the number of threads used for the constraint sweeps.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Access the constraint coloring used during the last multithreaded solve.
+    const ChConstraintColoring& GetColoring() const { return m_coloring; }
+
   private:
     double maxviolation;
+    int m_num_threads;                ///< number of threads for constraint sweeps
+    ChConstraintColoring m_coloring;  ///< constraint coloring for multithreaded sweeps
 };
 
 /// @} chrono_solver
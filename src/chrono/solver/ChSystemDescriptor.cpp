@@ -12,11 +12,13 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
+#include "chrono/solver/ChConstraintTwoTuplesRollingN.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
@@ -27,7 +29,18 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : c_a(1.0),
+      m_num_threads(1),
+      n_q(0),
+      n_c(0),
+      freeze_count(false),
+      m_scatter_valid(false),
+      m_scatter_updates(0),
+      m_sparse_products(false),
+      m_sparse_valid(false),
+      m_sparse_updates(0),
+      m_project_blocks_valid(false) {
     m_constraints.clear();
     m_variables.clear();
     m_KRMblocks.clear();
@@ -93,6 +106,8 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     CountActiveVariables();
     CountActiveConstraints();
     freeze_count = true;
+    m_sparse_valid = false;
+    m_project_blocks_valid = false;
 }
 
 void ChSystemDescriptor::PasteMassKRMMatrixInto(ChSparseMatrix& Z,
@@ -107,9 +122,128 @@ void ChSystemDescriptor::PasteMassKRMMatrixInto(ChSparseMatrix& Z,
     }
 
     // Contribution of stiffness, damping and mass matrices
+    PasteKRMBlocksInto(Z, start_row, start_col);
+}
+
+void ChSystemDescriptor::PasteKRMBlocksInto(ChSparseMatrix& Z, unsigned int start_row, unsigned int start_col) const {
+    // Fall back on element-wise insertion if the sparsity pattern is not settled
+    if (!Z.isCompressed() ||
+        (!IsKRMScatterValid(Z, start_row, start_col) && !UpdateKRMScatter(Z, start_row, start_col))) {
+        m_scatter_valid = false;
+        for (const auto& KRMBlock : m_KRMblocks) {
+            KRMBlock->PasteMatrixInto(Z, start_row, start_col, false);
+        }
+        return;
+    }
+
+    double* values = Z.valuePtr();
+    int num_colors = (int)m_scatter_color_start.size() - 1;
+    for (int color = 0; color < num_colors; color++) {
+        int start = (int)m_scatter_color_start[color];
+        int end = (int)m_scatter_color_start[color + 1];
+#pragma omp parallel for schedule(dynamic, 16) num_threads(m_num_threads) if (m_num_threads > 1)
+        for (int i = start; i < end; i++) {
+            unsigned int ib = m_scatter_color_list[i];
+            m_KRMblocks[ib]->ScatterMatrixInto(values, m_scatter_indices[ib]);
+        }
+    }
+}
+
+bool ChSystemDescriptor::IsKRMScatterValid(const ChSparseMatrix& Z,
+                                           unsigned int start_row,
+                                           unsigned int start_col) const {
+    if (!m_scatter_valid || start_row != m_scatter_start_row || start_col != m_scatter_start_col ||
+        m_KRMblocks != m_scatter_blocks)
+        return false;
+
+    // Check that the matrix structure did not change. Compare the index arrays themselves (rather than only their
+    // addresses), since a reallocated matrix may end up at the same address with a different sparsity pattern.
+    if ((size_t)Z.outerSize() + 1 != m_scatter_outer.size() || (size_t)Z.nonZeros() != m_scatter_inner.size() ||
+        !std::equal(m_scatter_outer.begin(), m_scatter_outer.end(), Z.outerIndexPtr()) ||
+        !std::equal(m_scatter_inner.begin(), m_scatter_inner.end(), Z.innerIndexPtr()))
+        return false;
+
+    // Check that the offsets and activity status of the block variables did not change
+    size_t k = 0;
     for (const auto& KRMBlock : m_KRMblocks) {
-        KRMBlock->PasteMatrixInto(Z, start_row, start_col, false);
+        for (unsigned int iv = 0; iv < KRMBlock->GetNumVariables(); iv++) {
+            auto var = KRMBlock->GetVariable(iv);
+            if (k >= m_scatter_signature.size() ||
+                m_scatter_signature[k++] != (var->IsActive() ? (int)var->GetOffset() : -1))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool ChSystemDescriptor::UpdateKRMScatter(const ChSparseMatrix& Z,
+                                          unsigned int start_row,
+                                          unsigned int start_col) const {
+    const unsigned int num_blocks = (unsigned int)m_KRMblocks.size();
+
+    // Locations of KRM entries in the matrix value array
+    m_scatter_indices.resize(num_blocks);
+    for (unsigned int ib = 0; ib < num_blocks; ib++) {
+        if (!m_KRMblocks[ib]->ComputeScatterIndices(Z, start_row, start_col, m_scatter_indices[ib]))
+            return false;
+    }
+
+    // Greedy coloring of KRM blocks, such that blocks with the same color do not share active variables
+    // (variables are identified by their offset)
+    std::vector<std::vector<unsigned int>> var_colors(CountActiveVariables());
+    std::vector<unsigned int> block_color(num_blocks);
+    std::vector<unsigned int> mark;  // mark[c] = ib + 1 if color c is used by a variable of block ib
+    unsigned int num_colors = 0;
+    m_scatter_signature.clear();
+
+    for (unsigned int ib = 0; ib < num_blocks; ib++) {
+        const auto& KRMBlock = m_KRMblocks[ib];
+        for (unsigned int iv = 0; iv < KRMBlock->GetNumVariables(); iv++) {
+            auto var = KRMBlock->GetVariable(iv);
+            m_scatter_signature.push_back(var->IsActive() ? (int)var->GetOffset() : -1);
+            if (var->IsActive()) {
+                for (auto c : var_colors[var->GetOffset()])
+                    mark[c] = ib + 1;
+            }
+        }
+
+        unsigned int color = 0;
+        while (color < num_colors && mark[color] == ib + 1)
+            color++;
+        if (color == num_colors) {
+            num_colors++;
+            mark.push_back(0);
+        }
+
+        for (unsigned int iv = 0; iv < KRMBlock->GetNumVariables(); iv++) {
+            auto var = KRMBlock->GetVariable(iv);
+            if (var->IsActive())
+                var_colors[var->GetOffset()].push_back(color);
+        }
+        block_color[ib] = color;
     }
+
+    m_scatter_color_start.assign(num_colors + 1, 0);
+    for (auto color : block_color)
+        m_scatter_color_start[color + 1]++;
+    for (unsigned int c = 0; c < num_colors; c++)
+        m_scatter_color_start[c + 1] += m_scatter_color_start[c];
+
+    m_scatter_color_list.resize(num_blocks);
+    std::vector<unsigned int> next(m_scatter_color_start.begin(), m_scatter_color_start.end() - 1);
+    for (unsigned int ib = 0; ib < num_blocks; ib++)
+        m_scatter_color_list[next[block_color[ib]]++] = ib;
+
+    m_scatter_outer.assign(Z.outerIndexPtr(), Z.outerIndexPtr() + Z.outerSize() + 1);
+    m_scatter_inner.assign(Z.innerIndexPtr(), Z.innerIndexPtr() + Z.nonZeros());
+    m_scatter_start_row = start_row;
+    m_scatter_start_col = start_col;
+    m_scatter_blocks = m_KRMblocks;
+    m_scatter_valid = true;
+    m_scatter_updates++;
+
+    return true;
 }
 
 unsigned int ChSystemDescriptor::PasteConstraintsJacobianMatrixInto(ChSparseMatrix& Z,
@@ -181,6 +315,30 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
     }
 }
 
+void ChSystemDescriptor::BuildSystemMatrixPattern(ChSparseMatrix& Z) const {
+    n_q = CountActiveVariables();
+
+    n_c = CountActiveConstraints();
+
+    Z.conservativeResize(n_q + n_c, n_q + n_c);
+
+    for (const auto& var : m_variables) {
+        if (var->IsActive()) {
+            var->PasteMassInto(Z, 0, 0, c_a);
+        }
+    }
+
+    for (const auto& KRMBlock : m_KRMblocks) {
+        KRMBlock->PasteMatrixInto(Z, 0, 0, false);
+    }
+
+    PasteConstraintsJacobianMatrixInto(Z, n_q, 0);
+
+    PasteConstraintsJacobianMatrixTransposedInto(Z, 0, n_q);
+
+    PasteComplianceMatrixInto(Z, n_q, n_q);
+}
+
 unsigned int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector, unsigned int start_row) const {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -369,6 +527,101 @@ unsigned int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& m
     return n_q + n_c;
 }
 
+void ChSystemDescriptor::EnableSparseProducts(bool val) {
+    m_sparse_products = val;
+    m_sparse_valid = false;
+}
+
+void ChSystemDescriptor::SetupSparseProducts() {
+    if (!m_sparse_products) {
+        m_sparse_valid = false;
+        return;
+    }
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    // The compliance terms are not part of the packed Jacobians and are always refreshed
+    m_E.resize(n_c);
+    for (const auto& constr : m_constraints) {
+        if (constr->IsActive())
+            m_E(constr->GetOffset()) = constr->GetComplianceTerm();
+    }
+
+    // Reuse the packed matrices if still valid
+    if (m_sparse_valid && m_Cq.rows() == n_c && m_Cq.cols() == n_q)
+        return;
+
+    // Pack the constraint Jacobians, reusing the sparsity pattern of unchanged rows
+    ChSparsityPatternLearner learner(n_c, n_q);
+    PasteConstraintsJacobianMatrixInto(learner);
+    learner.Learn(m_Cq_pattern);
+    m_Cq_pattern.Apply(m_Cq);
+    PasteConstraintsJacobianMatrixInto(m_Cq);
+    m_CqT = m_Cq.transpose();
+
+    // Map each column of the Jacobian to the owning variables
+    m_col_var.assign(n_q, nullptr);
+    for (const auto& var : m_variables) {
+        if (var->IsActive()) {
+            for (unsigned int j = 0; j < var->GetDOF(); j++)
+                m_col_var[var->GetOffset() + j] = var;
+        }
+    }
+
+    // Compute the rows of [Cq][M^(-1)], one variable block at a time (M is block diagonal).
+    // Within each row, the columns of a given variable block are contiguous.
+    const int* outer = m_Cq.outerIndexPtr();
+    const int* inner = m_Cq.innerIndexPtr();
+    const double* values = m_Cq.valuePtr();
+    ChSparseMatrix CqMinv(n_c, n_q);
+    CqMinv.reserve(m_Cq.nonZeros());
+    ChVectorDynamic<> block_in;
+    ChVectorDynamic<> block_out;
+    for (int i = 0; i < (int)n_c; i++) {
+        CqMinv.startVec(i);
+        int k = outer[i];
+        while (k < outer[i + 1]) {
+            ChVariables* var = m_col_var[inner[k]];
+            int offset = var->GetOffset();
+            int dof = var->GetDOF();
+            block_in.setZero(dof);
+            block_out.resize(dof);
+            for (; k < outer[i + 1] && inner[k] < offset + dof; k++)
+                block_in(inner[k] - offset) = values[k];
+            var->ComputeMassInverseTimesVector(block_out, block_in);
+            for (int j = 0; j < dof; j++)
+                CqMinv.insertBack(i, offset + j) = block_out(j);
+        }
+    }
+    CqMinv.finalize();
+    m_MinvCqT = CqMinv.transpose();
+
+    m_tmp_q.resize(n_q);
+    m_tmp_l.resize(n_c);
+    m_sparse_valid = true;
+    m_sparse_updates++;
+}
+
+bool ChSystemDescriptor::UsePackedMatrices() const {
+    return m_sparse_products && m_sparse_valid && m_Cq.rows() == n_c && m_Cq.cols() == n_q;
+}
+
+// Compute y = A*x for a compressed row-major sparse matrix, in parallel over the rows of A
+static void SparseTimesVector(const ChSparseMatrix& A, const double* x, double* y, int num_threads) {
+    const int* outer = A.outerIndexPtr();
+    const int* inner = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+    int rows = (int)A.rows();
+#pragma omp parallel for schedule(static, 256) num_threads(num_threads) if (num_threads > 1 && rows > 1024)
+    for (int i = 0; i < rows; i++) {
+        double sum = 0;
+        for (int k = outer[i]; k < outer[i + 1]; k++)
+            sum += values[k] * x[inner[k]];
+        y[i] = sum;
+    }
+}
+
 void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
                                                 const ChVectorDynamic<>& lvector,
                                                 std::vector<bool>* enabled) {
@@ -376,6 +629,26 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     assert(m_KRMblocks.size() == 0);
     assert(lvector.size() == CountActiveConstraints());
 
+    if (UsePackedMatrices()) {
+        result.resize(n_c);
+
+        // Disabled constraints do not contribute to the product
+        const double* l = lvector.data();
+        if (enabled) {
+            for (unsigned int i = 0; i < n_c; i++)
+                m_tmp_l(i) = (*enabled)[i] ? lvector(i) : 0.0;
+            l = m_tmp_l.data();
+        }
+
+        // result = [Cq]*([M^(-1)][Cq']*l) + [E]*l
+        SparseTimesVector(m_MinvCqT, l, m_tmp_q.data(), m_num_threads);
+        SparseTimesVector(m_Cq, m_tmp_q.data(), result.data(), m_num_threads);
+        for (unsigned int i = 0; i < n_c; i++)
+            result(i) = (!enabled || (*enabled)[i]) ? result(i) + m_E(i) * l[i] : 0.0;
+
+        return;
+    }
+
     result.setZero(n_c);
 
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
@@ -448,6 +721,18 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
         krm_block->AddMatrixTimesVectorInto(result, x);
     }
 
+    if (UsePackedMatrices()) {
+        // 1.3)  add also [Cq]'*x.l
+        SparseTimesVector(m_CqT, x.data() + n_q, m_tmp_q.data(), m_num_threads);
+        result.head(n_q) += m_tmp_q;
+
+        // 2) Second row: result.l part =  [C_q]*x.q + [E]*x.l
+        SparseTimesVector(m_Cq, x.data(), result.data() + n_q, m_num_threads);
+        result.tail(n_c) += m_E.cwiseProduct(x.tail(n_c));
+
+        return;
+    }
+
     // 1.3)  add also [Cq]'*x.l  (NON straight parallelizable - risk of concurrency in writing)
     for (const auto& constr : m_constraints) {
         if (constr->IsActive()) {
@@ -468,14 +753,46 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
 void ChSystemDescriptor::ConstraintsProject(ChVectorDynamic<>& multipliers) {
     FromVectorToConstraints(multipliers);
 
-    for (const auto& constr : m_constraints) {
-        if (constr->IsActive())
-            constr->Project();
+    int num_constraints = (int)m_constraints.size();
+    if (m_num_threads > 1 && num_constraints > 1024) {
+        // Blocks of constraints which are projected together can be processed in parallel
+        if (!m_project_blocks_valid)
+            UpdateProjectionBlocks();
+        int num_blocks = (int)m_project_blocks.size() - 1;
+#pragma omp parallel for schedule(dynamic, 256) num_threads(m_num_threads)
+        for (int ib = 0; ib < num_blocks; ib++) {
+            for (unsigned int ic = m_project_blocks[ib]; ic < m_project_blocks[ib + 1]; ic++) {
+                if (m_constraints[ic]->IsActive())
+                    m_constraints[ic]->Project();
+            }
+        }
+    } else {
+        for (const auto& constr : m_constraints) {
+            if (constr->IsActive())
+                constr->Project();
+        }
     }
 
     FromConstraintsToVector(multipliers, false);
 }
 
+void ChSystemDescriptor::UpdateProjectionBlocks() {
+    // A frictional contact projects its normal and tangential multipliers together (triplet of constraints), and
+    // rolling friction constraints, inserted right after the contact triplet, also modify its normal multiplier.
+    m_project_blocks.clear();
+    unsigned int num_constraints = (unsigned int)m_constraints.size();
+    unsigned int ic = 0;
+    while (ic < num_constraints) {
+        bool friction = m_constraints[ic]->GetMode() == ChConstraint::Mode::FRICTION;
+        bool rolling = friction && dynamic_cast<ChConstraintTwoTuplesRollingNall*>(m_constraints[ic]) != nullptr;
+        if (!rolling || m_project_blocks.empty())
+            m_project_blocks.push_back(ic);
+        ic += friction ? 3 : 1;
+    }
+    m_project_blocks.push_back(num_constraints);
+    m_project_blocks_valid = true;
+}
+
 void ChSystemDescriptor::UnknownsProject(ChVectorDynamic<>& mx) {
     n_q = CountActiveVariables();
 
@@ -15,8 +15,10 @@
 #ifndef CHSYSTEMDESCRIPTOR_H
 #define CHSYSTEMDESCRIPTOR_H
 
+#include <algorithm>
 #include <vector>
 
+#include "chrono/core/ChSparsityPatternLearner.h"
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChKRMBlock.h"
 #include "chrono/solver/ChVariables.h"
@@ -88,6 +90,8 @@ class ChApi ChSystemDescriptor {
         m_constraints.clear();
         m_variables.clear();
         m_KRMblocks.clear();
+        m_sparse_valid = false;
+        m_project_blocks_valid = false;
     }
 
     /// Insert reference to a ChConstraint object.
@@ -127,6 +131,42 @@ class ChApi ChSystemDescriptor {
     /// Get the c_a coefficient (default=1) used for scaling the M masses of the m_variables.
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of threads used for assembling the system matrix and for sparse products (default: 1).
+    /// This is set automatically by the owner ChSystem (see ChSystem::SetNumThreads).
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(1, num_threads); }
+
+    /// Get the number of threads used for assembling the system matrix and for sparse products.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Enable the use of packed sparse matrices in SchurComplementProduct() and SystemProduct() (default: false).
+    /// If enabled, SetupSparseProducts() packs all constraint Jacobians [Cq] and the products [M^(-1)][Cq'] in CSR
+    /// matrices, and the Schur complement and system products are then performed as multithreaded sparse
+    /// matrix-vector products, instead of through virtual calls on each constraint. This is beneficial for iterative
+    /// solvers that perform many products per solve (e.g., ChSolverAPGD, ChSolverBB, ChSolverPMINRES).
+    void EnableSparseProducts(bool val);
+
+    /// Return true if packed sparse matrices are used for the Schur complement and system products.
+    bool UseSparseProducts() const { return m_sparse_products; }
+
+    /// Pack the constraint Jacobians in sparse matrices, for use in subsequent products.
+    /// This function must be called after the constraint Jacobians are loaded and before the first product of a
+    /// solve (solvers supporting sparse products do so at the beginning of Solve). No-op if sparse products are not
+    /// enabled. The packed matrices are reused until the counts and offsets of variables and constraints are updated
+    /// or InvalidateSparseProducts() is called; only the compliance terms are refreshed at each call.
+    virtual void SetupSparseProducts();
+
+    /// Mark the packed matrices as out of date, so that they are rebuilt at the next call to SetupSparseProducts().
+    /// Must be called whenever the constraint Jacobians are reloaded or the masses of the variables change (the owner
+    /// ChSystem does so in LoadConstraintJacobians).
+    void InvalidateSparseProducts() { m_sparse_valid = false; }
+
+    /// Return the number of times the packed matrices were (re)built.
+    unsigned int GetNumSparseProductUpdates() const { return m_sparse_updates; }
+
+    /// Return the packed constraint Jacobian [Cq] (size: n. of active constraints x n. of active variables).
+    /// Only valid after a call to SetupSparseProducts() with sparse products enabled.
+    const ChSparseMatrix& GetPackedJacobian() const { return m_Cq; }
+
     /// Get a vector with all the 'fb' known terms associated to all variables, ordered into a column vector.
     /// The column vector must be passed as a ChMatrix<> object, which will be automatically reset and resized to the
     /// proper length if necessary.
@@ -255,6 +295,7 @@ class ChApi ChSystemDescriptor {
     /// Note! the 'l_i' data in the ChConstraints of the system descriptor are changed
     /// by this operation (they get the value of 'multipliers' after the projection), so
     /// it may happen that you need to backup them via FromConstraintToVector().
+    /// For large problems, blocks of constraints are projected in parallel (see SetNumThreads).
     virtual void ConstraintsProject(
         ChVectorDynamic<>& multipliers  ///< system-level vector of 'l_i' multipliers to be projected
     );
@@ -321,6 +362,15 @@ class ChApi ChSystemDescriptor {
                                    ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     ) const;
 
+    /// Record the sparsity pattern of the system matrix (as assembled by BuildSystemMatrix) into the given matrix.
+    /// Intended for use with a ChSparsityPatternLearner. All KRM blocks are pasted element-wise, so that the cached
+    /// locations for scattering KRM blocks into the actual system matrix are neither used nor invalidated.
+    virtual void BuildSystemMatrixPattern(ChSparseMatrix& Z) const;
+
+    /// Return the number of times the locations for scattering KRM blocks into a compressed system matrix were
+    /// (re)computed. Useful for diagnosing a sparsity pattern which is not reused across calls.
+    unsigned int GetNumKRMScatterUpdates() const { return m_scatter_updates; }
+
     /// Write the current system matrix blocks and right-hand side components.
     /// The system matrix is formed by calling BuildSystemMatrix() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
@@ -371,10 +421,61 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  ///< coefficient form M mass matrices in m_variables
 
+    int m_num_threads;  ///< number of threads used for matrix assembly
+
   private:
+    /// Add the KRM blocks into the given sparse matrix.
+    /// If the matrix is compressed and its sparsity pattern contains all KRM entries (e.g., with a locked sparsity
+    /// pattern), the KRM values are scattered directly into the matrix value array, using precomputed locations.
+    /// Since blocks acting on disjoint sets of variables write to disjoint entries, the KRM blocks are partitioned in
+    /// colors and the blocks in each color are processed in parallel.
+    void PasteKRMBlocksInto(ChSparseMatrix& Z, unsigned int start_row, unsigned int start_col) const;
+
+    /// Check whether the cached KRM scatter data is valid for the given matrix.
+    bool IsKRMScatterValid(const ChSparseMatrix& Z, unsigned int start_row, unsigned int start_col) const;
+
+    /// Compute the KRM scatter data for the given matrix. Return false if not possible.
+    bool UpdateKRMScatter(const ChSparseMatrix& Z, unsigned int start_row, unsigned int start_col) const;
+
+    /// Check whether the packed sparse matrices can be used for products.
+    bool UsePackedMatrices() const;
+
+    /// Partition the constraints in blocks which must be projected together (see ConstraintsProject).
+    void UpdateProjectionBlocks();
+
     mutable unsigned int n_q;  ///< number of active variables
     mutable unsigned int n_c;  ///< number of active constraints
     bool freeze_count;         ///< cache the number of active variables and constraints
+
+    // Cached data for scattering KRM blocks directly into a compressed system matrix
+    mutable bool m_scatter_valid;                             ///< true if the scatter data was computed
+    mutable unsigned int m_scatter_updates;                   ///< number of scatter data computations
+    mutable std::vector<int> m_scatter_outer;                 ///< copy of the outer index array of the cached matrix
+    mutable std::vector<int> m_scatter_inner;                 ///< copy of the inner index array of the cached matrix
+    mutable unsigned int m_scatter_start_row;                 ///< row offset used for the scatter indices
+    mutable unsigned int m_scatter_start_col;                 ///< column offset used for the scatter indices
+    mutable std::vector<ChKRMBlock*> m_scatter_blocks;        ///< KRM blocks covered by the scatter data
+    mutable std::vector<int> m_scatter_signature;             ///< offsets of the block variables (-1 if inactive)
+    mutable std::vector<std::vector<int>> m_scatter_indices;  ///< per-block locations in the matrix value array
+    mutable std::vector<unsigned int> m_scatter_color_list;   ///< block indices, sorted by color
+    mutable std::vector<unsigned int> m_scatter_color_start;  ///< start of each color in the list (plus end)
+
+    // Packed matrices for sparse Schur complement and system products
+    bool m_sparse_products;               ///< use packed sparse matrices for products
+    bool m_sparse_valid;                  ///< true if the packed matrices are up to date
+    unsigned int m_sparse_updates;        ///< number of times the packed matrices were built
+    ChSparseMatrix m_Cq;                  ///< constraint Jacobian [Cq]
+    ChSparseMatrix m_CqT;                 ///< transposed constraint Jacobian [Cq']
+    ChSparseMatrix m_MinvCqT;             ///< product [M^(-1)][Cq']
+    ChVectorDynamic<> m_E;                ///< diagonal compliance terms [E]
+    ChVectorDynamic<> m_tmp_q;            ///< work vector (size: n. of active variables)
+    ChVectorDynamic<> m_tmp_l;            ///< work vector (size: n. of active constraints)
+    ChSparsityPattern m_Cq_pattern;       ///< cached sparsity pattern of [Cq]
+    std::vector<ChVariables*> m_col_var;  ///< variables owning each column of [Cq]
+
+    // Blocks of constraints for parallel projection
+    bool m_project_blocks_valid;                 ///< true if the projection blocks are up to date
+    std::vector<unsigned int> m_project_blocks;  ///< start of each block (plus end)
 };
 
 CH_CLASS_VERSION(ChSystemDescriptor, 0)
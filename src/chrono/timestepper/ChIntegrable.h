@@ -68,6 +68,17 @@ class ChApi ChIntegrable {
     /// Return the number of lagrangian multipliers i.e. of scalar constraints.
     virtual unsigned int GetNumConstraints() { return 0; }
 
+    /// Return a counter identifying the current setup of the linear solver used in StateSolveCorrection.
+    /// This counter must change whenever the solver setup data (e.g., a matrix factorization) is replaced, so that
+    /// implicit integrators which reuse the Newton matrix across steps can detect that it is no longer available.
+    /// The default implementation returns 0 (no tracking).
+    virtual unsigned int GetSolverSetupCounter() const { return 0; }
+
+    /// Compute and load the constraint Jacobians at the current state, without setting up the linear solver.
+    /// Used by implicit integrators which reuse the Newton matrix across steps, so that the Cq'*L residual terms are
+    /// not evaluated with the Jacobians loaded at an earlier solver setup. The default implementation does nothing.
+    virtual void LoadConstraintJacobians() {}
+
     /// Set up the system state.
     virtual void StateSetup(ChState& y, ChStateDelta& dy) {
         y.resize(GetNumCoordsPosLevel() + GetNumCoordsVelLevel());
@@ -407,6 +407,68 @@ void ChTimestepperLeapfrog::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+bool ChImplicitIterativeTimestepper::JacobianUpdateNeeded(ChIntegrable* integrable,
+                                                          unsigned int iteration,
+                                                          double c_a,
+                                                          double c_v,
+                                                          double c_x) {
+    bool update = false;
+    switch (jacobian_update) {
+        case JacobianUpdate::EVERY_ITERATION:
+            update = true;
+            break;
+        case JacobianUpdate::EVERY_STEP:
+            update = (iteration == 0) || jac_force;
+            break;
+        case JacobianUpdate::AUTOMATIC:
+            update = !jac_valid || jac_force ||                                                     //
+                     integrable->GetNumCoordsVelLevel() != jac_nv ||                                //
+                     integrable->GetNumConstraints() != jac_nc ||                                   //
+                     integrable->GetSolverSetupCounter() != jac_counter ||                          //
+                     c_a != jac_c_a || c_v != jac_c_v || c_x != jac_c_x;
+            break;
+    }
+
+    if (update) {
+        jac_c_a = c_a;
+        jac_c_v = c_v;
+        jac_c_x = c_x;
+        jac_nv = integrable->GetNumCoordsVelLevel();
+        jac_nc = integrable->GetNumConstraints();
+        jac_force = false;
+    }
+
+    return update;
+}
+
+void ChImplicitIterativeTimestepper::JacobianIterationDone(ChIntegrable* integrable,
+                                                           bool setup_called,
+                                                           double update_norm) {
+    if (setup_called) {
+        // Record the setup counter *after* the setup triggered by this integrator
+        jac_valid = true;
+        jac_counter = integrable->GetSolverSetupCounter();
+    } else if (jacobian_update == JacobianUpdate::AUTOMATIC && jac_prev_norm > 0 &&
+               update_norm > jacobian_max_rate * jac_prev_norm) {
+        // Slow convergence with an out-of-date Newton matrix: re-evaluate at next iteration
+        jac_force = true;
+    }
+    jac_prev_norm = update_norm;
+}
+
+void ChImplicitIterativeTimestepper::JacobianStepDone(bool converged) {
+    if (!converged && jacobian_update == JacobianUpdate::AUTOMATIC)
+        jac_force = true;
+    jac_prev_norm = 0;
+}
+
+void ChImplicitIterativeTimestepper::JacobianRefreshConstraints(ChIntegrable* integrable) {
+    if (jacobian_update == JacobianUpdate::AUTOMATIC && jac_valid)
+        integrable->LoadConstraintJacobians();
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 CH_UPCASTING(ChTimestepperEulerImplicit, ChTimestepperIIorder)
@@ -444,9 +506,11 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    bool converged = false;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+        JacobianRefreshConstraints(mintegrable);
         R.setZero();
         Qc.setZero();
         mintegrable->LoadResidual_F(R, dt);                // R  = dt*f
@@ -459,8 +523,12 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        bool call_setup = JacobianUpdateNeeded(mintegrable, i, 1.0, -dt, -dt * dt);
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -470,13 +538,15 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
+        numsetups += call_setup ? 1 : 0;
         numsolves++;
 
+        JacobianIterationDone(mintegrable, call_setup, Dv.lpNorm<Eigen::Infinity>());
+
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
 
@@ -485,6 +555,8 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
+    JacobianStepDone(converged);
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -762,9 +834,11 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    bool converged = false;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+        JacobianRefreshConstraints(mintegrable);
         R = Rold;
         Qc.setZero();
         mintegrable->LoadResidual_F(R, dt * 0.5);       // + dt/2*f_new
@@ -777,8 +851,12 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             std::cout << " Trapezoidal iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        bool call_setup = JacobianUpdateNeeded(mintegrable, i, 1.0, -dt * 0.5, -dt * dt * 0.25);
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -788,13 +866,15 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
+            call_setup                      // force a call to the solver's Setup() function
         );
 
         numiters++;
-        numsetups++;
+        numsetups += call_setup ? 1 : 0;
         numsolves++;
 
+        JacobianIterationDone(mintegrable, call_setup, Dv.lpNorm<Eigen::Infinity>());
+
         Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
 
@@ -803,6 +883,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
         Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
     }
 
+    JacobianStepDone(converged);
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -1077,10 +1159,11 @@ void ChTimestepperNewmark::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-    bool call_setup = true;
+    bool converged = false;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
+        JacobianRefreshConstraints(mintegrable);
 
         R.setZero(mintegrable->GetNumCoordsVelLevel());
         Qc.setZero(mintegrable->GetNumConstraints());
@@ -1100,10 +1183,13 @@ void ChTimestepperNewmark::Advance(const double dt) {
                 std::cout << " Newmark NR converged (" << i << ")."
                           << "  T = " << T + dt << "  h = " << dt << std::endl;
             }
+            converged = true;
             break;
         }
 
-        if (verbose && modified_Newton && call_setup)
+        bool call_setup = JacobianUpdateNeeded(mintegrable, i, 1.0, -dt * gamma, -dt * dt * beta);
+
+        if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
             std::cout << " Newmark call Setup." << std::endl;
 
         mintegrable->StateSolveCorrection(  //
@@ -1123,8 +1209,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
             numsetups++;
         }
 
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+        JacobianIterationDone(mintegrable, call_setup, Da.lpNorm<Eigen::Infinity>());
 
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
@@ -1134,6 +1219,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
         Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
     }
 
+    JacobianStepDone(converged);
+
     X = Xnew;
     V = Vnew;
     A = Anew;
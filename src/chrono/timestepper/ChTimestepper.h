@@ -16,6 +16,7 @@
 #define CHTIMESTEPPER_H
 
 #include <cstdlib>
+#include <vector>
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/serialization/ChArchive.h"
@@ -80,6 +81,14 @@ class ChApi ChTimestepper {
     /// Turn on/off logging of messages.
     void SetVerbose(bool verb) { verbose = verb; }
 
+    /// Append to the given vector the internal integrator data that carries over from one step to the next (e.g., an
+    /// internal step size). Used for state snapshots (see utils::ChStateSnapshot).
+    virtual void GatherInternalState(std::vector<double>& data) const {}
+
+    /// Restore the internal integrator data saved with GatherInternalState, reading from the given position.
+    /// Return the position past the last value read.
+    virtual size_t ScatterInternalState(const std::vector<double>& data, size_t pos) { return pos; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive);
 
@@ -232,6 +241,14 @@ class ChApi ChImplicitTimestepper {};
 /// using an iterative process, up to a desired tolerance. At each iteration,
 /// a linear system must be solved.
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Strategy for re-evaluating the Newton matrix (and its factorization) during the nonlinear solution.
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< full Newton: the Newton matrix is re-evaluated at every iteration
+        EVERY_STEP,       ///< modified Newton: the Newton matrix is re-evaluated once per step
+        AUTOMATIC         ///< the Newton matrix is reused across iterations and steps, and re-evaluated when needed
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
@@ -242,11 +259,51 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    JacobianUpdate jacobian_update;  ///< strategy for re-evaluating the Newton matrix
+    double jacobian_max_rate;        ///< maximum convergence rate accepted with an out-of-date Newton matrix
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_update(JacobianUpdate::EVERY_ITERATION),
+          jacobian_max_rate(0.3),
+          jac_valid(false),
+          jac_force(false),
+          jac_c_a(0),
+          jac_c_v(0),
+          jac_c_x(0),
+          jac_nv(0),
+          jac_nc(0),
+          jac_counter(0),
+          jac_prev_norm(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
+    /// Set the strategy for re-evaluating the Newton matrix.
+    /// With JacobianUpdate::AUTOMATIC, the Newton matrix (and its factorization, for a direct linear solver) is kept
+    /// across Newton iterations and across steps. It is re-evaluated only if the problem size or the method
+    /// coefficients change (e.g., after a stepsize change), if the linear solver was set up by some other analysis,
+    /// if the observed convergence rate exceeds the limit set with SetJacobianMaxConvergenceRate, or if the Newton
+    /// iteration did not converge in the previous step.
+    /// The default strategy depends on the concrete integrator.
+    void SetJacobianUpdateMethod(JacobianUpdate method) { jacobian_update = method; }
+
+    /// Get the strategy for re-evaluating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the maximum convergence rate (ratio of successive Newton update norms) accepted when iterating with an
+    /// out-of-date Newton matrix. If exceeded, the Newton matrix is re-evaluated at the next iteration.
+    /// Only used with JacobianUpdate::AUTOMATIC. Default: 0.3.
+    void SetJacobianMaxConvergenceRate(double rate) { jacobian_max_rate = rate; }
+
+    /// Force a re-evaluation of the Newton matrix at the next Newton iteration.
+    void ForceJacobianUpdate() { jac_force = true; }
+
     /// Set the max number of iterations using the Newton Raphson procedure
     void SetMaxIters(int iters) { maxiters = iters; }
     /// Get the max number of iterations using the Newton Raphson procedure
@@ -284,6 +341,36 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+  protected:
+    /// Decide whether the Newton matrix must be re-evaluated (i.e., the solver's Setup function called) at the
+    /// specified Newton iteration, given the coefficients of the Newton matrix for the current step.
+    bool JacobianUpdateNeeded(ChIntegrable* integrable, unsigned int iteration, double c_a, double c_v, double c_x);
+
+    /// Record the result of a Newton iteration.
+    /// Here, 'setup_called' indicates whether the Newton matrix was re-evaluated and 'update_norm' is the norm of the
+    /// Newton update, used to monitor the convergence rate.
+    void JacobianIterationDone(ChIntegrable* integrable, bool setup_called, double update_norm);
+
+    /// Record the outcome of the Newton iteration for the current step (must be called after each nonlinear solve).
+    void JacobianStepDone(bool converged);
+
+    /// Refresh the constraint Jacobians at the current state, before loading the Cq'*L residual terms.
+    /// Only done with the automatic strategy, where the Jacobians loaded at the last solver setup may be out of date
+    /// by several steps. The other strategies keep using the Jacobians of the current Newton matrix.
+    void JacobianRefreshConstraints(ChIntegrable* integrable);
+
+  private:
+    bool jac_valid;              ///< was the Newton matrix evaluated (by this integrator)?
+    bool jac_force;              ///< force a re-evaluation of the Newton matrix
+    double jac_c_a;              ///< M coefficient of current Newton matrix
+    double jac_c_v;              ///< dF/dv coefficient of current Newton matrix
+    double jac_c_x;              ///< dF/dx coefficient of current Newton matrix
+    unsigned int jac_nv;         ///< number of coordinates at last evaluation of the Newton matrix
+    unsigned int jac_nc;         ///< number of constraints at last evaluation of the Newton matrix
+    unsigned int jac_counter;    ///< solver setup counter at last evaluation of the Newton matrix
+    double jac_prev_norm;        ///< norm of the previous Newton update
+
+  public:
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) {
         // version number
@@ -637,14 +724,13 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChVectorDynamic<> R;
     ChVectorDynamic<> Rold;
     ChVectorDynamic<> Qc;
-    bool modified_Newton;
 
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
         : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
-        modified_Newton = true;  // default use modified Newton with jacobian factorization only at beginning
+        jacobian_update = JacobianUpdate::EVERY_STEP;  // default use modified Newton
     }
 
     virtual Type GetType() const override { return Type::NEWMARK; }
@@ -667,7 +753,10 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once per step.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// Equivalent to SetJacobianUpdateMethod with JacobianUpdate::EVERY_STEP or JacobianUpdate::EVERY_ITERATION.
+    void SetModifiedNewton(bool val) {
+        jacobian_update = val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
@@ -33,9 +33,9 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
+      num_successful_steps(0) {
     SetAlpha(-0.2);  // default: some dissipation
+    jacobian_update = JacobianUpdate::EVERY_STEP;  // default: modified Newton
 }
 
 void ChTimestepperHHT::SetAlpha(double val) {
@@ -101,14 +101,16 @@ void ChTimestepperHHT::Advance(const double dt) {
     // If using modified Newton, a matrix update occurs:
     //   - at the beginning of a step
     //   - on a stepsize decrease
-    //   - if the Newton iteration does not converge with an out-of-date matrix
+    // With the automatic strategy, a matrix update occurs:
+    //   - on a change in stepsize (or problem size)
+    //   - if the Newton iteration converges slowly or does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
     call_setup = true;
 
     // Loop until reaching final time
     while (true) {
         Prepare(mintegrable);
+        matrix_is_current = false;
 
         // Newton for state at T+h
         Da_nrm_hist.fill(0.0);
@@ -117,7 +119,9 @@ void ChTimestepperHHT::Advance(const double dt) {
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            call_setup = JacobianUpdateNeeded(mintegrable, numiters, 1 / (1 + alpha), -h * gamma, -h * h * beta);
+
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
@@ -130,8 +134,7 @@ void ChTimestepperHHT::Advance(const double dt) {
                 numsetups++;
             }
 
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            JacobianIterationDone(mintegrable, call_setup, Da.norm());
 
             // Check convergence
             converged = CheckConvergence(it);
@@ -139,6 +142,8 @@ void ChTimestepperHHT::Advance(const double dt) {
                 break;
         }
 
+        JacobianStepDone(converged);
+
         if (converged) {
             // ------ NR converged
 
@@ -166,20 +171,16 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
-
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+        } else if (jacobian_update == JacobianUpdate::AUTOMATIC && !matrix_is_current) {
+            // ------ NR did not converge but the matrix was out-of-date
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                call_setup = true;
-            */
+            // re-attempt step with updated matrix (forced by JacobianStepDone)
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -219,7 +220,7 @@ void ChTimestepperHHT::Advance(const double dt) {
             }
 
             // force a matrix re-evaluation (due to change in stepsize)
-            call_setup = true;
+            ForceJacobianUpdate();
         }
 
         if (T >= tfinal) {
@@ -277,6 +278,7 @@ void ChTimestepperHHT::Prepare(ChIntegrableIIorder* integrable) {
 void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     // Scatter the current estimate of state at time T+h
     integrable->StateScatter(Xnew, Vnew, T + h, false);
+    JacobianRefreshConstraints(integrable);
 
     // Initialize the two segments of the RHS
     R = Rold;      // terms related to state at time T
@@ -307,8 +309,9 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
     Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
 
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
+    // If Setup was called at this iteration, the Newton matrix was evaluated during the current step attempt
+    if (call_setup)
+        matrix_is_current = true;
 }
 
 // Convergence test
@@ -356,6 +359,17 @@ void ChTimestepperHHT::CalcErrorWeights(const ChVectorDynamic<>& x, double rtol,
     ewt = (rtol * x.cwiseAbs() + atol).cwiseInverse();
 }
 
+void ChTimestepperHHT::GatherInternalState(std::vector<double>& data) const {
+    data.push_back(h);
+    data.push_back(num_successful_steps);
+}
+
+size_t ChTimestepperHHT::ScatterInternalState(const std::vector<double>& data, size_t pos) {
+    h = data[pos++];
+    num_successful_steps = (unsigned int)data[pos++];
+    return pos;
+}
+
 void ChTimestepperHHT::ArchiveOut(ChArchiveOut& archive) {
     // version number
     archive.VersionWrite<ChTimestepperHHT>();
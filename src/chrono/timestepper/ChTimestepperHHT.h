@@ -73,7 +73,10 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    /// Equivalent to SetJacobianUpdateMethod with JacobianUpdate::EVERY_STEP or JacobianUpdate::EVERY_ITERATION.
+    void SetModifiedNewton(bool enable) {
+        jacobian_update = enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -83,6 +86,12 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// convergence rate estimate is set to 1.
     double GetEstimatedConvergenceRate() const { return convergence_rate; }
 
+    /// Append the internal step size and the count of successful steps (used for step size control).
+    virtual void GatherInternalState(std::vector<double>& data) const override;
+
+    /// Restore the internal step size and the count of successful steps.
+    virtual size_t ScatterInternalState(const std::vector<double>& data, size_t pos) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) override;
 
@@ -123,8 +132,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                           ///< internal stepsize
     unsigned int num_successful_steps;  ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
+    bool matrix_is_current;  ///< was the Newton matrix evaluated during the current step attempt?
     bool call_setup;         ///< should the solver's Setup function be called?
 
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
@@ -27,6 +27,14 @@
 #include <ratio>
 #include <chrono>
 #include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace chrono {
 namespace utils {
@@ -46,6 +54,46 @@ inline float Profile_Get_Tick_Rate(void) {
     return 1000.f;
 }
 
+// Owner of the profile tree (the thread that last called ChProfileManager::Reset).
+static std::thread::id gProfileTreeOwner = std::this_thread::get_id();
+
+// Timeline event recorded by a CH_PROFILE scope (times in microseconds since the trace origin).
+struct ChProfileEvent {
+    const char* name;
+    double start;
+    double end;
+};
+
+// Per-thread buffer of timeline events. Buffers are owned by the global list below, so that they outlive the
+// threads that filled them; each thread only appends to its own buffer. The mutex only protects the list of buffers
+// (registration of a new thread); the events in a buffer are appended without locking and are read or cleared only
+// outside parallel regions (see ChProfileManager).
+struct ChProfileThreadBuffer {
+    int tid;
+    std::vector<ChProfileEvent> events;
+};
+
+static std::atomic<bool> gTraceEnabled(false);
+static std::mutex gTraceMutex;
+static std::vector<std::unique_ptr<ChProfileThreadBuffer>> gTraceBuffers;
+static std::chrono::steady_clock::time_point gTraceOrigin = std::chrono::steady_clock::now();
+static thread_local ChProfileThreadBuffer* tTraceBuffer = nullptr;
+
+static double Trace_Get_Time() {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - gTraceOrigin).count();
+}
+
+static ChProfileThreadBuffer* Trace_Get_Buffer() {
+    if (!tTraceBuffer) {
+        std::lock_guard<std::mutex> lock(gTraceMutex);
+        gTraceBuffers.push_back(std::unique_ptr<ChProfileThreadBuffer>(new ChProfileThreadBuffer));
+        tTraceBuffer = gTraceBuffers.back().get();
+        tTraceBuffer->tid = (int)gTraceBuffers.size() - 1;
+        tTraceBuffer->events.reserve(1024);
+    }
+    return tTraceBuffer;
+}
+
 /***************************************************************************************************
 **
 ** ChProfileNode
@@ -231,6 +279,7 @@ void ChProfileManager::Stop_Profile(void) {
  *    This resets everything except for the tree structure.  All of the timing data is reset.  *
  *=============================================================================================*/
 void ChProfileManager::Reset(void) {
+    gProfileTreeOwner = std::this_thread::get_id();
     gProfileClock.reset();
     gProfileClock.start();
     Root.Reset();
@@ -314,6 +363,141 @@ void ChProfileManager::dumpAll() {
     ChProfileManager::Release_Iterator(profileIterator);
 }
 
+/***************************************************************************************************
+**
+** Timeline tracing
+**
+***************************************************************************************************/
+
+void ChProfileManager::EnableTrace(bool val) {
+    gTraceEnabled = val;
+}
+
+bool ChProfileManager::IsTraceEnabled() {
+    return gTraceEnabled;
+}
+
+void ChProfileManager::ClearTrace() {
+    std::lock_guard<std::mutex> lock(gTraceMutex);
+    for (auto& buffer : gTraceBuffers)
+        buffer->events.clear();
+    gTraceOrigin = std::chrono::steady_clock::now();
+}
+
+static void Trace_Write_Name(std::ofstream& out, const char* name) {
+    out << '"';
+    for (const char* c = name; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            out << '\\';
+        out << *c;
+    }
+    out << '"';
+}
+
+bool ChProfileManager::WriteTrace(const std::string& filename) {
+    std::ofstream out(filename);
+    if (!out.is_open())
+        return false;
+
+    std::lock_guard<std::mutex> lock(gTraceMutex);
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& buffer : gTraceBuffers) {
+        if (buffer->events.empty())
+            continue;
+        if (!first)
+            out << ",\n";
+        first = false;
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->tid
+            << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+        for (const auto& event : buffer->events) {
+            out << ",\n{\"name\":";
+            Trace_Write_Name(out, event.name);
+            out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid << ",\"ts\":" << event.start
+                << ",\"dur\":" << event.end - event.start << "}";
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return out.good();
+}
+
+std::vector<ChProfileScopeStats> ChProfileManager::GetScopeStats() {
+    // Scopes are identified by name (the same name may be used from different translation units)
+    std::map<std::string, ChProfileScopeStats> stats;
+
+    std::lock_guard<std::mutex> lock(gTraceMutex);
+    for (const auto& buffer : gTraceBuffers) {
+        std::map<std::string, double> thread_time;
+        for (const auto& event : buffer->events) {
+            double duration = (event.end - event.start) / 1000;
+            auto& st = stats[event.name];
+            if (st.num_calls == 0) {
+                st.name = event.name;
+                st.min_time = duration;
+                st.max_time = duration;
+            }
+            st.num_calls++;
+            st.total_time += duration;
+            st.min_time = std::min(st.min_time, duration);
+            st.max_time = std::max(st.max_time, duration);
+            thread_time[event.name] += duration;
+        }
+        for (const auto& tt : thread_time) {
+            auto& st = stats[tt.first];
+            st.num_threads++;
+            st.max_thread_time = std::max(st.max_thread_time, tt.second);
+        }
+    }
+
+    std::vector<ChProfileScopeStats> result;
+    result.reserve(stats.size());
+    for (auto& st : stats) {
+        st.second.mean_thread_time = st.second.total_time / st.second.num_threads;
+        result.push_back(st.second);
+    }
+    std::sort(result.begin(), result.end(),
+              [](const ChProfileScopeStats& a, const ChProfileScopeStats& b) { return a.total_time > b.total_time; });
+
+    return result;
+}
+
+void ChProfileManager::dumpScopeStats() {
+    auto stats = GetScopeStats();
+
+    printf("----------------------------------\n");
+    printf("Profiling: per-scope timeline statistics (times in ms) ---\n");
+    printf("%-32s %8s %7s %12s %10s %10s %10s\n", "scope", "calls", "threads", "total", "min", "max", "imbalance");
+    for (const auto& st : stats) {
+        double imbalance = st.mean_thread_time > 0 ? st.max_thread_time / st.mean_thread_time : 1.0;
+        printf("%-32s %8d %7d %12.3f %10.4f %10.4f %10.3f\n", st.name.c_str(), st.num_calls, st.num_threads,
+               st.total_time, st.min_time, st.max_time, imbalance);
+    }
+}
+
+/***************************************************************************************************
+**
+** ChProfileSample
+**
+***************************************************************************************************/
+
+ChProfileSample::ChProfileSample(const char* name) : m_name(name), m_start(-1) {
+    m_tree = (std::this_thread::get_id() == gProfileTreeOwner);
+    if (m_tree)
+        ChProfileManager::Start_Profile(name);
+    if (gTraceEnabled.load(std::memory_order_relaxed))
+        m_start = Trace_Get_Time();
+}
+
+ChProfileSample::~ChProfileSample(void) {
+    if (m_start >= 0)
+        Trace_Get_Buffer()->events.push_back({m_name, m_start, Trace_Get_Time()});
+    if (m_tree)
+        ChProfileManager::Stop_Profile();
+}
+
 #endif  // CH_NO_PROFILE
 
 }  // end namespace utils
@@ -34,6 +34,8 @@
     #include <ctime>
     #include <ratio>
     #include <chrono>
+    #include <string>
+    #include <vector>
     #include "chrono/core/ChApiCE.h"
 
 namespace chrono {
@@ -103,7 +105,28 @@ class ChApi ChProfileIterator {
     friend class ChProfileManager;
 };
 
+/// Statistics for one profiled scope, aggregated over all timeline events recorded on all threads.
+/// All times are in milliseconds. The ratio max_thread_time / mean_thread_time is a measure of load imbalance for
+/// scopes executed inside parallel regions.
+struct ChProfileScopeStats {
+    std::string name;             ///< scope name
+    int num_calls = 0;            ///< number of calls, over all threads
+    int num_threads = 0;          ///< number of threads that executed this scope
+    double total_time = 0;        ///< total time, over all calls and threads
+    double min_time = 0;          ///< shortest call
+    double max_time = 0;          ///< longest call
+    double mean_thread_time = 0;  ///< average of the per-thread total times
+    double max_thread_time = 0;   ///< largest per-thread total time
+};
+
 /// The Manager for the Profile system.
+/// The hierarchical profile tree is only updated by the thread that last called Reset() (by default the main thread);
+/// CH_PROFILE scopes entered on other threads are ignored by the tree. If timeline tracing is enabled, every scope on
+/// every thread (including OpenMP worker threads) is also recorded, with its begin and end timestamps, in a buffer
+/// local to the calling thread. Recorded events can be exported as a Chrome/Perfetto trace or aggregated per scope.
+/// Per-thread buffers are filled without locking; the functions that read or clear the recorded events (ClearTrace,
+/// WriteTrace, GetScopeStats, dumpScopeStats) must therefore only be called outside parallel regions, when no
+/// CH_PROFILE scope is active on another thread.
 class ChApi ChProfileManager {
   public:
     static void Start_Profile(const char* name);
@@ -123,6 +146,29 @@ class ChApi ChProfileManager {
 
     static void dumpAll();
 
+    /// Enable/disable recording of per-thread timeline events (default: false).
+    static void EnableTrace(bool val);
+
+    /// Return true if per-thread timeline events are being recorded.
+    static bool IsTraceEnabled();
+
+    /// Discard all recorded timeline events and reset the trace time origin.
+    /// Must only be called outside parallel regions.
+    static void ClearTrace();
+
+    /// Write all recorded timeline events to a JSON file in the Chrome trace event format.
+    /// The file can be loaded in chrome://tracing or https://ui.perfetto.dev. Returns false if the file could not be
+    /// written. Must only be called outside parallel regions.
+    static bool WriteTrace(const std::string& filename);
+
+    /// Return per-scope statistics aggregated over all recorded timeline events, sorted by decreasing total time.
+    /// Must only be called outside parallel regions.
+    static std::vector<ChProfileScopeStats> GetScopeStats();
+
+    /// Print the per-scope statistics of recorded timeline events.
+    /// Must only be called outside parallel regions.
+    static void dumpScopeStats();
+
   private:
     static ChProfileNode Root;
     static ChProfileNode* CurrentNode;
@@ -131,11 +177,16 @@ class ChApi ChProfileManager {
 };
 
 /// Simple way to profile a function's scope.
+/// Safe to use on any thread, including inside OpenMP parallel regions.
 class ChApi ChProfileSample {
   public:
-    ChProfileSample(const char* name) { ChProfileManager::Start_Profile(name); }
+    ChProfileSample(const char* name);
+    ~ChProfileSample(void);
 
-    ~ChProfileSample(void) { ChProfileManager::Stop_Profile(); }
+  private:
+    const char* m_name;
+    double m_start;  ///< timeline start time (negative if not recording a timeline event)
+    bool m_tree;     ///< true if this sample updates the profile tree
 };
 
 }  // end namespace utils
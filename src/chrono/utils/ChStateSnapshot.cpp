@@ -0,0 +1,206 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/utils/ChStateSnapshot.h"
+
+namespace chrono {
+namespace utils {
+
+// File header: magic string followed by the format version
+static const char snapshot_magic[8] = {'C', 'H', 'S', 'N', 'A', 'P', 0, 0};
+
+ChStateSnapshot::ChStateSnapshot() : m_valid(false), m_time(0) {}
+
+std::vector<ChConstraint*> ChStateSnapshot::GatherJacobians(ChSystem& sys, std::vector<double>& data) {
+    // Contact constraints are injected after all other constraints
+    ChSystemDescriptor descriptor;
+    sys.GetContactContainer()->InjectConstraints(descriptor);
+    size_t num_contacts = descriptor.GetConstraints().size();
+    descriptor.BeginInsertion();
+    sys.InjectConstraints(descriptor);
+
+    auto& all = descriptor.GetConstraints();
+    std::vector<ChConstraint*> constraints(all.begin(), all.end() - num_contacts);
+    for (auto constraint : constraints)
+        constraint->GatherJacobian(data);
+
+    return constraints;
+}
+
+void ChStateSnapshot::Capture(ChSystem& sys) {
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    ChStateDelta a(sys.GetNumCoordsVelLevel(), &sys);
+    ChVectorDynamic<> L(sys.GetNumConstraints());
+
+    sys.StateGather(x, v, m_time);
+    sys.StateGatherAcceleration(a);
+    sys.StateGatherReactions(L);
+
+    m_x = x;
+    m_v = v;
+    m_a = a;
+
+    // Contact reactions are stored after those of all other constraints. Contacts cannot be identified by their index
+    // once the contact list is regenerated, so their forces are captured separately, keyed by the contact pair.
+    m_L = L.head(sys.GetNumConstraints() - sys.GetContactContainer()->GetNumConstraints());
+    m_contacts.clear();
+    sys.GetContactContainer()->GatherContactReactions(m_contacts);
+
+    // Jacobians of constraints other than contacts, as loaded at the last solver setup
+    m_jacobians.clear();
+    GatherJacobians(sys, m_jacobians);
+
+    m_integr.clear();
+    sys.GetTimestepper()->GatherInternalState(m_integr);
+
+    m_valid = true;
+}
+
+void ChStateSnapshot::Restore(ChSystem& sys) const {
+    if (!m_valid)
+        throw std::runtime_error("ChStateSnapshot::Restore: no captured state");
+    Eigen::Index nx = sys.GetNumCoordsPosLevel();
+    Eigen::Index nv = sys.GetNumCoordsVelLevel();
+    Eigen::Index nL = sys.GetNumConstraints();
+    Eigen::Index nc = sys.GetContactContainer()->GetNumConstraints();
+    if (m_x.size() != nx || m_v.size() != nv)
+        throw std::runtime_error("ChStateSnapshot::Restore: system structure does not match the snapshot");
+
+    ChState x(m_x, &sys);
+    ChStateDelta v(m_v, &sys);
+    ChStateDelta a(m_a, &sys);
+
+    sys.StateScatter(x, v, m_time, true);
+    sys.StateScatterAcceleration(a);
+
+    // Restore the reactions of constraints other than contacts (contact reactions are left unchanged)
+    if (m_L.size() == nL - nc) {
+        ChVectorDynamic<> L(nL);
+        sys.StateGatherReactions(L);
+        L.head(nL - nc) = m_L;
+        sys.StateScatterReactions(L);
+    }
+
+    // Contact forces are applied to the matching contacts generated at the next collision detection pass
+    sys.GetContactContainer()->SetPendingContactReactions(m_contacts);
+
+    // Restore the constraint Jacobians loaded at capture time. If the constraints do not match the snapshot, evaluate
+    // the Jacobians at the restored state instead.
+    std::vector<double> jacobians;
+    auto constraints = GatherJacobians(sys, jacobians);
+    if (jacobians.size() == m_jacobians.size()) {
+        size_t pos = 0;
+        for (auto constraint : constraints)
+            pos = constraint->ScatterJacobian(m_jacobians, pos);
+        sys.GetSystemDescriptor()->InvalidateSparseProducts();
+    } else {
+        sys.LoadConstraintJacobians();
+    }
+
+    auto timestepper = sys.GetTimestepper();
+    timestepper->SetTime(m_time);
+    timestepper->ScatterInternalState(m_integr, 0);
+
+    // The Newton matrix of an implicit integrator corresponds to a different state
+    if (auto implicit = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(timestepper))
+        implicit->ForceJacobianUpdate();
+
+    sys.ForceUpdate();
+}
+
+static void WriteVector(std::ofstream& out, const double* data, uint64_t size) {
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.write(reinterpret_cast<const char*>(data), size * sizeof(double));
+}
+
+static bool ReadVector(std::ifstream& in, ChVectorDynamic<>& vec) {
+    uint64_t size = 0;
+    if (!in.read(reinterpret_cast<char*>(&size), sizeof(size)))
+        return false;
+    vec.resize(size);
+    return (bool)in.read(reinterpret_cast<char*>(vec.data()), size * sizeof(double));
+}
+
+bool ChStateSnapshot::Write(const std::string& filename) const {
+    std::ofstream out(filename, std::ios::binary);
+    if (!out.is_open())
+        return false;
+
+    uint32_t ver = version;
+    out.write(snapshot_magic, sizeof(snapshot_magic));
+    out.write(reinterpret_cast<const char*>(&ver), sizeof(ver));
+    out.write(reinterpret_cast<const char*>(&m_time), sizeof(m_time));
+    WriteVector(out, m_x.data(), m_x.size());
+    WriteVector(out, m_v.data(), m_v.size());
+    WriteVector(out, m_a.data(), m_a.size());
+    WriteVector(out, m_L.data(), m_L.size());
+    WriteVector(out, m_integr.data(), m_integr.size());
+    WriteVector(out, m_jacobians.data(), m_jacobians.size());
+
+    uint64_t num_contacts = m_contacts.size();
+    out.write(reinterpret_cast<const char*>(&num_contacts), sizeof(num_contacts));
+    for (const auto& c : m_contacts) {
+        uint32_t ids[3] = {c.body_a, c.body_b, c.occurrence};
+        double force[3] = {c.force.x(), c.force.y(), c.force.z()};
+        out.write(reinterpret_cast<const char*>(ids), sizeof(ids));
+        out.write(reinterpret_cast<const char*>(force), sizeof(force));
+    }
+
+    return out.good();
+}
+
+bool ChStateSnapshot::Read(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open())
+        return false;
+
+    char magic[sizeof(snapshot_magic)];
+    uint32_t ver = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, snapshot_magic, sizeof(magic)) != 0)
+        return false;
+    if (!in.read(reinterpret_cast<char*>(&ver), sizeof(ver)) || ver != version)
+        return false;
+    if (!in.read(reinterpret_cast<char*>(&m_time), sizeof(m_time)))
+        return false;
+
+    ChVectorDynamic<> integr;
+    ChVectorDynamic<> jacobians;
+    m_valid = ReadVector(in, m_x) && ReadVector(in, m_v) && ReadVector(in, m_a) && ReadVector(in, m_L) &&
+              ReadVector(in, integr) && ReadVector(in, jacobians);
+    if (!m_valid)
+        return false;
+    m_integr.assign(integr.data(), integr.data() + integr.size());
+    m_jacobians.assign(jacobians.data(), jacobians.data() + jacobians.size());
+
+    uint64_t num_contacts = 0;
+    m_valid = (bool)in.read(reinterpret_cast<char*>(&num_contacts), sizeof(num_contacts));
+    m_contacts.clear();
+    for (uint64_t i = 0; m_valid && i < num_contacts; i++) {
+        uint32_t ids[3];
+        double force[3];
+        m_valid = in.read(reinterpret_cast<char*>(ids), sizeof(ids)) &&
+                  in.read(reinterpret_cast<char*>(force), sizeof(force));
+        m_contacts.push_back({ids[0], ids[1], ids[2], ChVector3d(force[0], force[1], force[2])});
+    }
+
+    return m_valid;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
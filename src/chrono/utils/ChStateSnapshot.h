@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_STATE_SNAPSHOT_H
+#define CH_STATE_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Binary snapshot of the dynamic state of a Chrono system.
+/// A snapshot holds the state vectors of the system (positions, velocities, accelerations, and reactions of the
+/// constraints other than contacts), the constraint Jacobians loaded at the last solver setup, and the internal data of
+/// the timestepper that carries over from one step to the next. The contact list is not captured; contacts are
+/// regenerated by collision detection at the next step, and the captured forces of contacts between bodies (keyed by
+/// the body pair) are used as initial guess for the matching new contacts. Unlike serialization through ChArchive, a
+/// snapshot does not describe the system itself: it can only be restored into an already constructed system with the
+/// same structure (same number of states), which makes it suitable for fast rollback (e.g., co-simulation, parameter
+/// sweeps).
+/// Snapshots can be kept in memory or written to a versioned binary file.
+class ChApi ChStateSnapshot {
+  public:
+    ChStateSnapshot();
+
+    /// Capture the current state of the given system.
+    /// This function should be called between steps (i.e., not during a call to DoStepDynamics).
+    void Capture(ChSystem& sys);
+
+    /// Restore the captured state into the given system.
+    /// An exception is thrown if the system structure does not match the one at capture time. Constraint reactions
+    /// (excluding contacts) are restored only if the number of these constraints matches; otherwise they are
+    /// recomputed at the next step. Similarly, the constraint Jacobians are restored only if the constraints match;
+    /// otherwise they are evaluated at the restored state.
+    void Restore(ChSystem& sys) const;
+
+    /// Write the snapshot to a binary file. Return false if the file could not be written.
+    bool Write(const std::string& filename) const;
+
+    /// Read a snapshot from a binary file. Return false if the file could not be read or has an unsupported version.
+    bool Read(const std::string& filename);
+
+    /// Return the simulation time at capture.
+    double GetTime() const { return m_time; }
+
+    /// Return true if the snapshot holds a captured state.
+    bool IsValid() const { return m_valid; }
+
+    /// Snapshot file format version.
+    static const unsigned int version = 3;
+
+  private:
+    bool m_valid;
+    double m_time;
+    ChVectorDynamic<> m_x;                                        ///< position-level states
+    ChVectorDynamic<> m_v;                                        ///< velocity-level states
+    ChVectorDynamic<> m_a;                                        ///< accelerations
+    ChVectorDynamic<> m_L;                                        ///< reactions of constraints other than contacts
+    std::vector<double> m_integr;                                 ///< timestepper internal data
+    std::vector<double> m_jacobians;                              ///< Jacobians of constraints other than contacts
+    std::vector<ChContactContainer::ContactReaction> m_contacts;  ///< forces of contacts between bodies
+
+    /// Append the Jacobians of all constraints other than contacts to the given vector and return these constraints.
+    static std::vector<ChConstraint*> GatherJacobians(ChSystem& sys, std::vector<double>& data);
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
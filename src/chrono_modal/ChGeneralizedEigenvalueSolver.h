@@ -24,7 +24,10 @@
 
 #include <complex>
 #include <functional>
+#include <list>
+#include <memory>
 #include <numeric>
+#include <vector>
 
 namespace chrono {
 
@@ -47,6 +50,9 @@ namespace modal {
 /// This means that only one of the complex eigenvectors that come in conjugate pairs is stored.
 /// The eigrequest argument is a list of pairs, where the first element is the number of modes to be found,
 /// and the second element is the shift to apply for that specific search.
+/// If the eigensolver is set to use more than one thread (see ChGeneralizedEigenvalueSolver::num_threads) and it
+/// supports cloning, the requests are solved concurrently, each with its own factorization of the shifted matrix.
+/// The results are merged in the order of the requests, so they do not depend on the number of threads.
 template <typename EigSolverType>
 int Solve(EigSolverType& eig_solver,
           ChSparseMatrix& A,
@@ -72,6 +78,7 @@ class ChGeneralizedEigenvalueSolver {
     int max_iterations = 500;             ///< upper limit for the number of iterations. If too low might not converge.
     bool verbose = false;                 ///< turn to true to see some diagnostic.
     mutable bool sort_ritz_pairs = true;  ///< sort the eigenvalues based on the smallest absolute value
+    int num_threads = 1;                  ///< number of shift spans solved concurrently (multiple requests only)
 
     /// Sort the eigenvalues and eigenvectors in the order specified by the ordering function in-place.
     static void SortRitzPairs(
@@ -162,8 +169,15 @@ class ChGeneralizedEigenvalueSolver {
     double GetTimeEigenSetup() const { return m_timer_eigen_setup(); }
 
     /// Get cumulative time for the eigensolver solution.
+    /// If the shift spans are solved concurrently, this is the wall-clock time for solving all spans.
     double GetTimeEigenSolver() const { return m_timer_eigen_solver(); }
 
+    /// Get the time for the eigensolver solution of the specified shift span at the last call to modal::Solve.
+    double GetTimeEigenSolver(int span) const { return m_time_spans[span]; }
+
+    /// Get the number of shift spans processed at the last call to modal::Solve.
+    int GetNumSpans() const { return (int)m_time_spans.size(); }
+
     /// Get cumulative time for post-solver solution postprocessing.
     double GetTimeSolutionPostProcessing() const { return m_timer_solution_postprocessing(); }
 
@@ -357,6 +371,7 @@ class ChGeneralizedEigenvalueSolver {
     mutable ChTimer m_timer_eigen_setup;              ///< timer for eigensolver setup
     mutable ChTimer m_timer_eigen_solver;             ///< timer for eigensolver solution
     mutable ChTimer m_timer_solution_postprocessing;  ///< timer for conversion of eigensolver solution
+    mutable std::vector<double> m_time_spans;         ///< solution time for each shift span at last modal::Solve
 
     const int m_min_subspace_size = 30;
 
@@ -405,7 +420,11 @@ int Solve(EigSolverType& eig_solver,
 
         eig_solver.m_timer_eigen_solver.start();
 
+        ChTimer timer_span;
+        timer_span.start();
         int converged_eigs = eig_solver.Solve(A, B, eigvects, eigvals, num_modes_total, eig_requests.begin()->second);
+        timer_span.stop();
+        eig_solver.m_time_spans.assign(1, timer_span());
 
         found_eigs = std::min(num_modes_total, converged_eigs);
 
@@ -427,30 +446,66 @@ int Solve(EigSolverType& eig_solver,
         // total number of found eigenvalues; might exceed num_modes_total, usually when complex pairs are found
         int total_found_eigs = 0;
 
-        // for each freq_spans finds the closest modes to i-th input frequency:
-        for (const auto& eig_req : eig_requests) {
-            eig_solver.m_timer_matrix_assembly.start();
-
-            ChMatrixDynamic<typename EigSolverType::ScalarType> eigvects_singlespan;
-            ChVectorDynamic<typename EigSolverType::ScalarType> eigvals_singlespan;
-
-            eig_solver.m_timer_matrix_assembly.stop();
-
-            eig_solver.m_timer_eigen_solver.start();
+        using ScalarType = typename EigSolverType::ScalarType;
+        std::vector<std::pair<int, ScalarType>> requests(eig_requests.begin(), eig_requests.end());
+        int num_spans = (int)requests.size();
+
+        std::vector<ChMatrixDynamic<ScalarType>> eigvects_spans(num_spans);
+        std::vector<ChVectorDynamic<ScalarType>> eigvals_spans(num_spans);
+        std::vector<int> converged_eigs(num_spans, 0);
+        eig_solver.m_time_spans.assign(num_spans, 0.0);
+
+        // for concurrent solution, each span uses its own copy of the eigensolver (with its own factorization);
+        // fall back on the sequential solution if the eigensolver cannot be cloned
+        std::vector<std::unique_ptr<EigSolverType>> eig_solvers;
+        if (eig_solver.num_threads > 1) {
+            for (int i = 0; i < num_spans; i++) {
+                std::unique_ptr<EigSolverType> clone(eig_solver.Clone());
+                if (!clone) {
+                    eig_solvers.clear();
+                    break;
+                }
+                eig_solvers.push_back(std::move(clone));
+            }
+        }
 
-            int converged_eigs =
-                eig_solver.Solve(A, B, eigvects_singlespan, eigvals_singlespan, eig_req.first, eig_req.second);
-            eig_solver.m_timer_eigen_solver.stop();
+        // for each freq_spans finds the closest modes to i-th input frequency:
+        eig_solver.m_timer_eigen_solver.start();
+        if (!eig_solvers.empty()) {
+#pragma omp parallel for schedule(dynamic, 1) num_threads(eig_solver.num_threads)
+            for (int i = 0; i < num_spans; i++) {
+                ChTimer timer_span;
+                timer_span.start();
+                converged_eigs[i] = eig_solvers[i]->Solve(A, B, eigvects_spans[i], eigvals_spans[i],
+                                                          requests[i].first, requests[i].second);
+                timer_span.stop();
+                eig_solver.m_time_spans[i] = timer_span();
+            }
+        } else {
+            for (int i = 0; i < num_spans; i++) {
+                ChTimer timer_span;
+                timer_span.start();
+                converged_eigs[i] = eig_solver.Solve(A, B, eigvects_spans[i], eigvals_spans[i], requests[i].first,
+                                                     requests[i].second);
+                timer_span.stop();
+                eig_solver.m_time_spans[i] = timer_span();
+            }
+        }
+        eig_solver.m_timer_eigen_solver.stop();
 
-            eig_solver.m_timer_solution_postprocessing.start();
+        // merge the results of all spans, in the order of the requests (discarding duplicates, if requested)
+        eig_solver.m_timer_solution_postprocessing.start();
+        for (int i = 0; i < num_spans; i++) {
+            const auto& eigvects_singlespan = eigvects_spans[i];
+            const auto& eigvals_singlespan = eigvals_spans[i];
 
             if (uniquify)
                 eig_solver.InsertUniqueRitzPairs(
                     eigvals_singlespan,
                     eigvects_clipping ? eigvects_singlespan.topRows(eigvects_clipping_length) : eigvects_singlespan,
-                    eigvals, eigvects, eig_solver.GetNaturalFrequency, total_found_eigs, converged_eigs);
+                    eigvals, eigvects, eig_solver.GetNaturalFrequency, total_found_eigs, converged_eigs[i]);
             else {
-                for (auto eig = 0; eig < converged_eigs; eig++) {
+                for (auto eig = 0; eig < converged_eigs[i]; eig++) {
                     eigvals[total_found_eigs] = eigvals_singlespan[eig];
                     if (eigvects_clipping)
                         eigvects.col(total_found_eigs) = eigvects_singlespan.col(eig).topRows(eigvects_clipping_length);
@@ -459,9 +514,9 @@ int Solve(EigSolverType& eig_solver,
                     total_found_eigs++;
                 }
             }
-
-            eig_solver.m_timer_solution_postprocessing.stop();
         }
+        eig_solver.m_timer_solution_postprocessing.stop();
+
         eig_solver.m_timer_solution_postprocessing.start();
 
         // clamp the number of found eigenvalues to the requested number of modes
@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cstring>
+#include <fstream>
+
 #include "chrono_modal/ChModalAssembly.h"
 #include "chrono_modal/ChGeneralizedEigenvalueSolver.h"
 #include "chrono/physics/ChSystem.h"
@@ -43,6 +46,7 @@ ChModalAssembly::ChModalAssembly(const ChModalAssembly& other) : ChAssembly(othe
     m_is_model_reduced = other.m_is_model_reduced;
     m_internal_nodes_update = other.m_internal_nodes_update;
     m_modal_automatic_gravity = other.m_modal_automatic_gravity;
+    m_reduction_cache_file = other.m_reduction_cache_file;
 
     modal_q = other.modal_q;
     modal_q_dt = other.modal_q_dt;
@@ -560,7 +564,21 @@ void ChModalAssembly::PartitionLocalSystemMatrices() {
     full_M_loc_ext.makeCompressed();
 }
 
-void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping& damping_model) {
+void ChModalAssembly::FactorizeInternalStiffness() {
+    ChSparseMatrix H_II;
+    if (m_num_constr_internal) {
+        // K_IIc = [  K_II   Cq_II' ]
+        //         [ Cq_II     0    ]
+        util_sparse_assembly_2x2symm(H_II, K_II_loc, Cq_II_loc * m_scaling_factor_CqI);
+        m_solver_invKIIc.analyzePattern(H_II);
+        m_solver_invKIIc.factorize(H_II);
+    } else {
+        m_solver_invKIIc.analyzePattern(K_II_loc);
+        m_solver_invKIIc.factorize(K_II_loc);
+    }
+}
+
+void ChModalAssembly::ComputeModeAccelerationBasis() {
     if (m_modal_reduction_type == ReductionType::HERTING && m_modal_eigvect.cols() < 6) {
         std::cerr << "ChModalAssembly: at least six rigid-body modes are required for Herting reduction method"
                   << std::endl;
@@ -577,17 +595,7 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     }
 
     // avoid computing K_IIc^{-1}, effectively do n times a linear solve:
-    ChSparseMatrix H_II;
-    if (m_num_constr_internal) {
-        // K_IIc = [  K_II   Cq_II' ]
-        //         [ Cq_II     0    ]
-        util_sparse_assembly_2x2symm(H_II, K_II_loc, Cq_II_loc * m_scaling_factor_CqI);
-        m_solver_invKIIc.analyzePattern(H_II);
-        m_solver_invKIIc.factorize(H_II);
-    } else {
-        m_solver_invKIIc.analyzePattern(K_II_loc);
-        m_solver_invKIIc.factorize(K_II_loc);
-    }
+    FactorizeInternalStiffness();
 
     // 1) Matrix of static modes (constrained, so use K_IIc instead of K_II,
     // the original unconstrained static reduction is: Psi_S = - K_II^{-1} * K_IB.
@@ -798,6 +806,22 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         this->K_red.bottomRightCorner(m_num_coords_static_correction, m_num_coords_static_correction) =
             Psi_Cor.transpose() * K_II_loc * Psi_Cor;
     }
+}
+
+void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping& damping_model) {
+    if (m_reduction_from_cache) {
+        // Psi, M_red, K_red were loaded from the cache file; K_IIc^{-1} is still needed to update the static
+        // correction mode during the simulation
+        if (m_num_coords_static_correction)
+            FactorizeInternalStiffness();
+        MBI_PsiST_MII = M_BI_loc + Psi_S.transpose() * M_II_loc;
+        MBI_PsiST_MII.makeCompressed();
+    } else {
+        ComputeModeAccelerationBasis();
+        if (!m_reduction_cache_file.empty() && !WriteReductionCache(m_reduction_hash))
+            std::cerr << "ChModalAssembly: cannot write the modal reduction cache " << m_reduction_cache_file
+                      << std::endl;
+    }
 
     {
         // Initialize the reduced damping matrix
@@ -847,6 +871,157 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     m_modal_eigvect.resize(0, 0);
 }
 
+// -----------------------------------------------------------------------------
+// Persistent cache of the modal reduction
+
+// File header: magic string followed by the format version
+static const char reduction_cache_magic[8] = {'C', 'H', 'M', 'O', 'D', 'R', 'E', 'D'};
+static const uint32_t reduction_cache_version = 1;
+
+// FNV-1a hash, accumulated over raw bytes
+static void HashBytes(uint64_t& hash, const void* data, size_t size) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+template <typename T>
+static void HashValue(uint64_t& hash, T val) {
+    HashBytes(hash, &val, sizeof(T));
+}
+
+// Hash the sparsity pattern and the values, independently of the storage state of the matrix
+static void HashSparse(uint64_t& hash, const ChSparseMatrix& mat) {
+    HashValue(hash, (int64_t)mat.rows());
+    HashValue(hash, (int64_t)mat.cols());
+    for (int k = 0; k < mat.outerSize(); ++k)
+        for (ChSparseMatrix::InnerIterator it(mat, k); it; ++it) {
+            HashValue(hash, (int64_t)it.row());
+            HashValue(hash, (int64_t)it.col());
+            HashValue(hash, it.value());
+        }
+}
+
+template <typename Matrix>
+static void WriteMatrix(std::ofstream& out, const Matrix& mat) {
+    uint64_t rows = mat.rows();
+    uint64_t cols = mat.cols();
+    out.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    out.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+    out.write(reinterpret_cast<const char*>(mat.data()), rows * cols * sizeof(typename Matrix::Scalar));
+}
+
+// Read a matrix with expected number of rows and columns (negative if not known in advance)
+template <typename Matrix>
+static bool ReadMatrix(std::ifstream& in, Matrix& mat, int64_t rows_expected, int64_t cols_expected) {
+    uint64_t rows = 0;
+    uint64_t cols = 0;
+    if (!in.read(reinterpret_cast<char*>(&rows), sizeof(rows)) ||
+        !in.read(reinterpret_cast<char*>(&cols), sizeof(cols)))
+        return false;
+    if ((rows_expected >= 0 && rows != (uint64_t)rows_expected) ||
+        (cols_expected >= 0 && cols != (uint64_t)cols_expected))
+        return false;
+    mat.resize(rows, cols);
+    return (bool)in.read(reinterpret_cast<char*>(mat.data()), rows * cols * sizeof(typename Matrix::Scalar));
+}
+
+uint64_t ChModalAssembly::ComputeReductionHash(const std::vector<ChModalSolver::ChFreqSpan>& freq_spans,
+                                               const std::string& solver_type,
+                                               const std::vector<double>& solver_settings) const {
+    uint64_t hash = 14695981039346656037ULL;
+
+    // reduction settings
+    HashValue(hash, (int)m_modal_reduction_type);
+    HashValue(hash, m_num_coords_static_correction);
+    HashValue(hash, m_scaling_factor_CqI);
+    for (const auto& span : freq_spans) {
+        HashValue(hash, span.nmodes);
+        HashValue(hash, span.freq);
+    }
+
+    // modal solver and eigensolver settings
+    HashBytes(hash, solver_type.data(), solver_type.size());
+    HashBytes(hash, solver_settings.data(), solver_settings.size() * sizeof(double));
+
+    // partition of the local matrices
+    HashValue(hash, m_num_coords_vel_boundary);
+    HashValue(hash, m_num_coords_vel_internal);
+    HashValue(hash, m_num_constr_boundary);
+    HashValue(hash, m_num_constr_internal);
+
+    // initial configuration (enters the rigid-body modes) and full local matrices
+    HashBytes(hash, m_full_state_x0.data(), m_full_state_x0.size() * sizeof(double));
+    HashSparse(hash, full_M_loc);
+    HashSparse(hash, full_K_loc);
+    HashSparse(hash, full_Cq_loc);
+
+    return hash;
+}
+
+bool ChModalAssembly::ReadReductionCache(uint64_t hash) {
+    std::ifstream in(m_reduction_cache_file, std::ios::binary);
+    if (!in.is_open())
+        return false;
+
+    char magic[sizeof(reduction_cache_magic)];
+    uint32_t ver = 0;
+    uint64_t file_hash = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, reduction_cache_magic, sizeof(magic)) != 0)
+        return false;
+    if (!in.read(reinterpret_cast<char*>(&ver), sizeof(ver)) || ver != reduction_cache_version)
+        return false;
+    if (!in.read(reinterpret_cast<char*>(&file_hash), sizeof(file_hash)) || file_hash != hash)
+        return false;
+
+    if (!ReadMatrix(in, m_modal_eigvals, -1, 1) || !ReadMatrix(in, m_modal_freq, m_modal_eigvals.size(), 1))
+        return false;
+
+    int64_t n_B = m_num_coords_vel_boundary;
+    int64_t n_I = m_num_coords_vel_internal;
+    int64_t n_L = m_num_constr_internal;
+    int64_t n_eta = m_modal_eigvals.size();
+    int64_t n_cor = m_num_coords_static_correction;
+    int64_t n_red = n_B + n_eta + n_cor;
+
+    bool ok = ReadMatrix(in, Psi_S, n_I, n_B) && ReadMatrix(in, Psi_D, n_I, n_eta) &&
+              ReadMatrix(in, Psi_Cor, n_I, n_cor) && ReadMatrix(in, Psi, n_B + n_I + n_L, n_red) &&
+              ReadMatrix(in, M_red, n_red, n_red) && ReadMatrix(in, K_red, n_red, n_red);
+    if (ok && n_L)
+        ok = ReadMatrix(in, Psi_S_LambdaI, n_L, n_B) && ReadMatrix(in, Psi_D_LambdaI, n_L, n_eta) &&
+             ReadMatrix(in, Psi_Cor_LambdaI, n_L, n_cor);
+
+    return ok;
+}
+
+bool ChModalAssembly::WriteReductionCache(uint64_t hash) const {
+    std::ofstream out(m_reduction_cache_file, std::ios::binary);
+    if (!out.is_open())
+        return false;
+
+    out.write(reduction_cache_magic, sizeof(reduction_cache_magic));
+    out.write(reinterpret_cast<const char*>(&reduction_cache_version), sizeof(reduction_cache_version));
+    out.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+
+    WriteMatrix(out, m_modal_eigvals);
+    WriteMatrix(out, m_modal_freq);
+    WriteMatrix(out, Psi_S);
+    WriteMatrix(out, Psi_D);
+    WriteMatrix(out, Psi_Cor);
+    WriteMatrix(out, Psi);
+    WriteMatrix(out, M_red);
+    WriteMatrix(out, K_red);
+    if (m_num_constr_internal) {
+        WriteMatrix(out, Psi_S_LambdaI);
+        WriteMatrix(out, Psi_D_LambdaI);
+        WriteMatrix(out, Psi_Cor_LambdaI);
+    }
+
+    return out.good();
+}
+
 void ChModalAssembly::UpdateStaticCorrectionMode() {
     if (!m_num_coords_static_correction)
         return;
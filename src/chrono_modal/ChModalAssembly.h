@@ -23,7 +23,10 @@
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/solver/ChVariablesGeneric.h"
 #include <complex>
+#include <cstdint>
 #include <iomanip>
+#include <string>
+#include <typeinfo>
 
 namespace chrono {
 namespace modal {
@@ -99,6 +102,20 @@ class ChApiModal ChModalAssembly : public ChAssembly {
         const ChModalDamping& damping_model = ChModalDampingNone()  ///< damping model
     );
 
+    /// Set a binary file used as a persistent cache of the modal reduction (default: none).
+    /// If set, DoModalReduction() first tries to load the reduced basis Psi and the reduced M and K matrices from this
+    /// file; these are reused only if the file was written for the same local M, K, Cq matrices, initial configuration,
+    /// reduction type, static correction setting and requested frequency spans. Otherwise, the eigenproblem is solved
+    /// as usual and the file is (over)written with the new results. The reduced damping matrix is always recomputed
+    /// from the damping model passed to DoModalReduction().
+    void SetReductionCacheFile(const std::string& filename) { m_reduction_cache_file = filename; }
+
+    /// Get the name of the modal reduction cache file (empty if caching is disabled).
+    const std::string& GetReductionCacheFile() const { return m_reduction_cache_file; }
+
+    /// Return true if the modal reduction was loaded from the cache file at the last call to DoModalReduction().
+    bool IsReductionFromCache() const { return m_reduction_from_cache; }
+
     /// Get the floating frame F of the reduced modal assembly.
     ChFrameMoving<> GetFloatingFrameOfReference() { return floating_frame_F; }
 
@@ -561,6 +578,32 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     /// Both Herting and Craig-Bampton reductions are implemented in this function.
     void ApplyModeAccelerationTransformation(const ChModalDamping& damping_model = ChModalDampingNone());
 
+    /// [INTERNAL USE ONLY]
+    /// Compute the mode transformation matrices Psi and the undamped reduced matrices M_red, K_red.
+    void ComputeModeAccelerationBasis();
+
+    /// Factorize the (constrained) stiffness matrix K_IIc of the internal part.
+    void FactorizeInternalStiffness();
+
+    /// Compute the key of the modal reduction cache from the local full matrices and the reduction settings.
+    /// The modal solver settings are provided by the eigensolver type name and by its numerical settings (see
+    /// GetModalSolverSettings).
+    uint64_t ComputeReductionHash(const std::vector<ChModalSolver::ChFreqSpan>& freq_spans,
+                                  const std::string& solver_type,
+                                  const std::vector<double>& solver_settings) const;
+
+    /// Collect the settings of the modal solver and of its eigensolver that affect the computed modes: Cq scaling,
+    /// eigenvector clipping, eigensolver tolerance, maximum number of iterations, Ritz pairs sorting and the
+    /// shift-and-invert shift of each frequency span.
+    template <typename EigensolverType>
+    static std::vector<double> GetModalSolverSettings(const ChModalSolverUndamped<EigensolverType>& modal_solver);
+
+    /// Load the modal reduction from the cache file. Return false if the file is missing or does not match.
+    bool ReadReductionCache(uint64_t hash);
+
+    /// Save the modal reduction to the cache file. Return false if the file could not be written.
+    bool WriteReductionCache(uint64_t hash) const;
+
     /// Computes the increment of the modal assembly (the increment of the current configuration respect
     /// to the initial "undeformed" configuration), and also gets the current speed.
     /// u_locred = P_W^T*[\delta qB; \delta eta]: corotated local displacement.
@@ -694,6 +737,10 @@ class ChApiModal ChModalAssembly : public ChAssembly {
 
     bool m_verbose = false;  ///< output m_verbose info
 
+    std::string m_reduction_cache_file;    ///< file used as persistent cache of the modal reduction
+    uint64_t m_reduction_hash = 0;         ///< key of the current modal reduction in the cache file
+    bool m_reduction_from_cache = false;   ///< flag to indicate whether the reduction was loaded from the cache
+
     bool m_internal_nodes_update;  ///< flag to indicate whether the internal nodes will update for
                                    ///< visualization/postprocessing
 
@@ -790,6 +837,21 @@ void ChModalAssembly::DoModalReduction(const ChModalSolverUndamped<EigensolverTy
     this->DoModalReduction(full_M, full_K, full_Cq, modal_solver, damping_model);
 }
 
+template <typename EigensolverType>
+std::vector<double> ChModalAssembly::GetModalSolverSettings(
+    const ChModalSolverUndamped<EigensolverType>& modal_solver) {
+    const auto& eig_solver = *modal_solver.GetEigenSolver();
+    std::vector<double> settings = {(double)modal_solver.GetScaleCq(), (double)modal_solver.GetClipPositionCoords(),
+                                    eig_solver.tolerance, (double)eig_solver.max_iterations,
+                                    (double)eig_solver.sort_ritz_pairs};
+    for (const auto& span : modal_solver.GetFrequencySpans()) {
+        auto shift = eig_solver.GetOptimalShift(span.freq);
+        settings.push_back(std::real(shift));
+        settings.push_back(std::imag(shift));
+    }
+    return settings;
+}
+
 template <typename EigensolverType>
 void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
                                        ChSparseMatrix& full_K,
@@ -823,8 +885,21 @@ void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
     PartitionLocalSystemMatrices();
 
     //// start of modal reduction transformation
+    // 0) look up the reduction in the cache file, if any
+    m_reduction_from_cache = false;
+    if (!m_reduction_cache_file.empty()) {
+        m_reduction_hash = ComputeReductionHash(modal_solver.GetFrequencySpans(), typeid(EigensolverType).name(),
+                                                GetModalSolverSettings(modal_solver));
+        m_reduction_from_cache = ReadReductionCache(m_reduction_hash);
+        if (m_verbose)
+            std::cout << "*** Modal reduction cache " << m_reduction_cache_file
+                      << (m_reduction_from_cache ? " loaded." : " not usable, reduction recomputed.") << std::endl;
+    }
+
     // 1) compute eigenvalue and eigenvectors
-    if (m_modal_reduction_type == ReductionType::HERTING) {
+    if (m_reduction_from_cache) {
+        // eigenvalues and frequencies are restored from the cache, the mode shapes are already contained in Psi_D
+    } else if (m_modal_reduction_type == ReductionType::HERTING) {
         if (modal_solver.GetNumRequestedModes() < 6) {
             std::cout << "*** At least six rigid-body modes are required for the HERTING modal reduction. "
                       << "The default settings are used." << std::endl;
@@ -853,7 +928,7 @@ void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
 
     // 2) bound ChVariables etc. to the modal coordinates, resize matrices, set as modal mode
     FlagModelAsReduced();
-    SetupModalData(m_modal_eigvect.cols());
+    SetupModalData((unsigned int)m_modal_eigvals.size());
 
     // 3) compute the transforamtion matrices, also the local rigid-body modes
     UpdateTransformationMatrix();
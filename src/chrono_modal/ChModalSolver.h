@@ -65,6 +65,12 @@ class ChApiModal ChModalSolver {
     /// Clip the eigenvectors to only the position coordinates.
     void SetClipPositionCoords(bool val) { m_clip_position_coords = val; }
 
+    /// Return true if the eigenvectors are clipped to only the position coordinates.
+    bool GetClipPositionCoords() const { return m_clip_position_coords; }
+
+    /// Return true if the Cq matrix is scaled to improve conditioning.
+    bool GetScaleCq() const { return m_scaleCq; }
+
     /// Get the set of frequency spans for which modes are requested.
     const std::vector<ChFreqSpan>& GetFrequencySpans() const { return m_freq_spans; }
 
@@ -49,6 +49,10 @@ class ChApiModal ChSymGenEigenvalueSolver : public ChGeneralizedEigenvalueSolver
                       int num_modes,
                       ScalarType shift) const = 0;
 
+    /// Create a copy of this eigensolver that can be used concurrently with this one.
+    /// Used by modal::Solve to process multiple shift spans in parallel. Return nullptr if not supported.
+    virtual ChSymGenEigenvalueSolver* Clone() const { return nullptr; }
+
     /// Retrieve the natural frequencies from an eigenvalues array.
     static void GetNaturalFrequencies(const ChVectorDynamic<ScalarType>& eigvals, ChVectorDynamic<double>& freq);
 
@@ -69,6 +73,10 @@ class ChApiModal ChSymGenEigenvalueSolverKrylovSchur : public ChSymGenEigenvalue
     ChSymGenEigenvalueSolverKrylovSchur() {}
     virtual ~ChSymGenEigenvalueSolverKrylovSchur(){};
 
+    virtual ChSymGenEigenvalueSolverKrylovSchur* Clone() const override {
+        return new ChSymGenEigenvalueSolverKrylovSchur(*this);
+    }
+
     /// Solve the generalized eigenvalue problem A*eigvects = B*eigvects*diag(eigvals)
     /// A and B are expected to be symmetric and real
     /// 'eigvects' will be resized to [A.rows() x num_modes]
@@ -92,6 +100,10 @@ class ChApiModal ChSymGenEigenvalueSolverLanczos : public ChSymGenEigenvalueSolv
     ChSymGenEigenvalueSolverLanczos() {}
     virtual ~ChSymGenEigenvalueSolverLanczos(){};
 
+    virtual ChSymGenEigenvalueSolverLanczos* Clone() const override {
+        return new ChSymGenEigenvalueSolverLanczos(*this);
+    }
+
     /// Solve the generalized eigenvalue problem A*eigvects = B*eigvects*diag(eigvals)
     /// A and B are expected to be symmetric and real
     /// 'eigvects' will be resized to [A.rows() x num_modes]
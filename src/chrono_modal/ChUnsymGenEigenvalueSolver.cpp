@@ -78,6 +78,15 @@ ChUnsymGenEigenvalueSolverKrylovSchur::ChUnsymGenEigenvalueSolverKrylovSchur(
     std::shared_ptr<ChDirectSolverLScomplex> linear_solver)
     : m_linear_solver(linear_solver) {}
 
+ChUnsymGenEigenvalueSolverKrylovSchur* ChUnsymGenEigenvalueSolverKrylovSchur::Clone() const {
+    std::shared_ptr<ChDirectSolverLScomplex> linear_solver(m_linear_solver->Clone());
+    if (!linear_solver)
+        return nullptr;
+    auto solver = new ChUnsymGenEigenvalueSolverKrylovSchur(*this);
+    solver->m_linear_solver = linear_solver;
+    return solver;
+}
+
 int ChUnsymGenEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& A,  ///< input A matrix
                                                  const ChSparseMatrix& B,  ///< input B matrix
                                                  ChMatrixDynamic<ScalarType>& eigvects,
@@ -51,6 +51,10 @@ class ChApiModal ChUnsymGenEigenvalueSolver : public ChGeneralizedEigenvalueSolv
                       int num_modes,
                       ScalarType sigma) const = 0;
 
+    /// Create a copy of this eigensolver that can be used concurrently with this one.
+    /// Used by modal::Solve to process multiple shift spans in parallel. Return nullptr if not supported.
+    virtual ChUnsymGenEigenvalueSolver* Clone() const { return nullptr; }
+
     static void GetNaturalFrequencies(const ChVectorDynamic<ScalarType>& eigvals,
                                       ChVectorDynamic<double>& natural_freq);
 
@@ -77,6 +81,10 @@ class ChApiModal ChUnsymGenEigenvalueSolverKrylovSchur : public ChUnsymGenEigenv
 
     virtual ~ChUnsymGenEigenvalueSolverKrylovSchur(){};
 
+    /// Create a copy of this eigensolver, with its own copy of the linear solver.
+    /// Return nullptr if the linear solver cannot be cloned.
+    virtual ChUnsymGenEigenvalueSolverKrylovSchur* Clone() const override;
+
     /// Solve the generalized eigenvalue problem A*eigvects = B*eigvects*diag(eigvals)
     /// A and B are real; potentially unsymmetric
     /// 'eigvects' will be resized to [A.rows() x num_modes]
@@ -19,6 +19,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_multicore/ChDataManager.h"
 #include "chrono_multicore/physics/Ch3DOFContainer.h"
 
@@ -131,3 +133,23 @@ void ChMulticoreDataManager::PrintMatrix(CompressedMatrix<real> src) {
         std::cout << std::endl;
     }
 }
+
+void chrono::MatchContactHistory(const std::vector<long long>& shapeIDs,
+                                 uint num_contacts,
+                                 const std::vector<long long>& keys,
+                                 std::vector<int>& index) {
+    const int num_keys = (int)keys.size();
+
+    // Index of each contact within its group of contacts with the same shape pair
+    std::vector<uint> occurrence(num_contacts);
+    for (uint i = 0; i < num_contacts; i++)
+        occurrence[i] = (i > 0 && shapeIDs[i] == shapeIDs[i - 1]) ? occurrence[i - 1] + 1 : 0;
+
+    index.resize(num_contacts);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        auto first = std::lower_bound(keys.begin(), keys.end(), shapeIDs[i]);
+        int j = (int)(first - keys.begin()) + occurrence[i];
+        index[i] = (j < num_keys && keys[j] == shapeIDs[i]) ? j : -1;
+    }
+}
@@ -191,9 +191,6 @@ typedef blaze::Subvector<const DynamicVector<real>> ConstSubVectorType;
 //// Viscosity
 // #define _GAMMAFFV_ submatrix(_gamma_,  _num_uni_ + _num_bil_ + 3 * _num_rf_c_ + _num_fluid_,  3 * _num_fluid_)
 
-// The maximum number of shear history contacts per smaller body (SMC)
-#define max_shear 20
-
 /// @addtogroup multicore_module
 /// @{
 
@@ -212,10 +209,14 @@ struct host_container {
     custom_vector<real3> ct_body_torque;  ///< Total contact torque on these bodies
 
     // Contact shear history (SMC)
-    custom_vector<vec3> shear_neigh;          ///< Neighbor list of contacting bodies and shapes
-    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement for each neighbor
-    custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude per contact pair
-    custom_vector<real> contact_duration;     ///< Accumulated contact duration, per contact pair
+    // These vectors hold one entry for each contact active at the end of the previous step, sorted by the shape pair
+    // key (see ChCollisionData::contact_shapeIDs). Contacts between the same pair of shapes appear in the order in
+    // which they were reported by the narrowphase. The table is rebuilt at each step, so its size is proportional to
+    // the number of actual contacts.
+    custom_vector<long long> shear_keys;      ///< Shape pair key, per history entry
+    custom_vector<real3> shear_disp;          ///< Accumulated shear displacement, per history entry
+    custom_vector<real> contact_relvel_init;  ///< Initial relative normal velocity manitude, per history entry
+    custom_vector<real> contact_duration;     ///< Accumulated contact duration, per history entry
 
     /// Mapping from all bodies in the system to bodies involved in a contact.
     /// For bodies that are currently not in contact, the mapping entry is -1.
@@ -313,6 +314,12 @@ struct host_container {
     /// If there are any bilateral constraints, the corresponding impulses are stored at the end of `gamma`.
     DynamicVector<real> gamma;
 
+    // Contact history (NSC warm starting)
+    // Contact forces (impulses divided by the step size) from the previous step, 6 values per contact (normal, 2
+    // sliding, and 3 spinning components), ordered by the IDs of the shape pairs in contact.
+    custom_vector<long long> ws_shapeIDs;  ///< shape pair IDs of contacts at previous step (sorted)
+    custom_vector<real> ws_force;          ///< contact forces at previous step
+
     /// Compliance matrix elements.
     /// Note that E is a diagonal matrix and hence stored in a vector.
     DynamicVector<real> E;
@@ -382,6 +389,16 @@ class CH_MULTICORE_API ChMulticoreDataManager {
     void PrintMatrix(CompressedMatrix<real> src);
 };
 
+/// Match the current contacts with the entries of a contact history table.
+/// The history table holds the shape pair IDs of the contacts at the previous step, sorted by value. Multiple contacts
+/// between the same pair of shapes are always stored contiguously (in the current contact list and in the history
+/// table) and are matched in order. On return, 'index' holds, for each current contact, the index of the matching
+/// history entry or -1 for a new contact.
+CH_MULTICORE_API void MatchContactHistory(const std::vector<long long>& shapeIDs,
+                                          uint num_contacts,
+                                          const std::vector<long long>& keys,
+                                          std::vector<int>& index);
+
 /// @} multicore_module
 
 }  // end namespace chrono
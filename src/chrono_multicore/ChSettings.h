@@ -43,7 +43,8 @@ class collision_settings {
           bin_size(real3(1, 1, 1)),
           grid_density(5),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
-          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
+          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID),
+          narrowphase_batching(true) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
     /// large a value will slow down the narrowphase collision detection). The envelope is the amount by which each
@@ -84,6 +85,10 @@ class collision_settings {
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     ChNarrowphase::Algorithm narrowphase_algorithm;
+
+    /// Flag controlling batched processing of sphere-sphere and box-sphere pairs in the narrowphase.
+    /// If enabled, such pairs are grouped and processed several at a time (in SIMD lanes, if available).
+    bool narrowphase_batching;
 };
 
 /// Chrono::Multicore solver_settings.
@@ -126,6 +131,7 @@ class solver_settings {
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
         skip_residual = 1;
+        warm_start = false;
     }
 
     /// The solver type variable defines name of the solver that will be used to
@@ -213,6 +219,10 @@ class solver_settings {
     real tolerance_objective;
     /// Compute residual every x iterations.
     int skip_residual;
+    /// Warm-start the contact impulses from the solution at the previous step (NSC only).
+    /// Persistent contacts are identified through the pair of shapes in contact. This can significantly reduce the
+    /// number of solver iterations for slowly evolving contact configurations (e.g., granular material at rest).
+    bool warm_start;
 };
 
 /// Aggregate of all settings for Chrono::Multicore.
@@ -75,6 +75,7 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
     narrowphase.algorithm = settings.narrowphase_algorithm;
+    narrowphase.EnableBatching(settings.narrowphase_batching);
 }
 
 void ChCollisionSystemChronoMulticore::PostProcess() {
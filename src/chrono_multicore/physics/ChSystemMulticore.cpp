@@ -624,6 +624,7 @@ void ChSystemMulticore::SetCollisionSystemType(ChCollisionSystem::Type type) {
     }
 
     collision_system = chrono_types::make_shared<ChCollisionSystemChronoMulticore>(data_manager);
+    collision_system->SetDeterministic(IsDeterministic());
     collision_system->SetSystem(this);
 }
 
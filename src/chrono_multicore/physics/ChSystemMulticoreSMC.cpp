@@ -38,15 +38,6 @@ ChSystemMulticoreSMC::ChSystemMulticoreSMC(const ChSystemMulticoreSMC& other) :
 
 void ChSystemMulticoreSMC::AddMaterialSurfaceData(std::shared_ptr<ChBody> newbody) {
     data_manager->host_data.mass_rigid.push_back(0);
-
-    if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-        for (int i = 0; i < max_shear; i++) {
-            data_manager->host_data.shear_neigh.push_back(vec3(-1, -1, -1));
-            data_manager->host_data.shear_disp.push_back(real3(0, 0, 0));
-            data_manager->host_data.contact_relvel_init.push_back(0);
-            data_manager->host_data.contact_duration.push_back(0);
-        }
-    }
 }
 
 void ChSystemMulticoreSMC::UpdateMaterialSurfaceData(int index, ChBody* body) {
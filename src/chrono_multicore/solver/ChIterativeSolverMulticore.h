@@ -91,6 +91,11 @@ class CH_MULTICORE_API ChIterativeSolverMulticoreNSC : public ChIterativeSolverM
     void ChangeSolverType(SolverType type);
 
   private:
+    /// Initialize the impulses of persistent contacts with the values cached at the previous step.
+    void WarmStartContacts();
+    /// Cache the contact impulses for warm-starting at the next step.
+    void CacheContactImpulses();
+
     ChSchurProduct SchurProductFull;
     ChProjectConstraints ProjectFull;
 };
@@ -116,8 +121,20 @@ class CH_MULTICORE_API ChIterativeSolverMulticoreSMC : public ChIterativeSolverM
     void host_CalcContactForces(custom_vector<int>& ct_bid,
                                 custom_vector<real3>& ct_force,
                                 custom_vector<real3>& ct_torque,
-                                custom_vector<vec2>& shape_pairs,
-                                custom_vector<char>& shear_touch);
+                                custom_vector<int>& shear_hist,
+                                custom_vector<char>& shear_touch,
+                                custom_vector<real3>& shear_disp,
+                                custom_vector<real>& contact_relvel_init,
+                                custom_vector<real>& contact_duration);
+
+    /// Find, for each current contact, the matching entry in the contact shear history table (or -1 if none).
+    void host_MatchContactHistory(custom_vector<int>& shear_hist);
+
+    /// Rebuild the contact shear history table from the contacts active at the current step.
+    void host_UpdateContactHistory(const custom_vector<char>& shear_touch,
+                                   const custom_vector<real3>& shear_disp,
+                                   const custom_vector<real>& contact_relvel_init,
+                                   const custom_vector<real>& contact_duration);
 
     void host_AddContactForces(uint ct_body_count, const custom_vector<int>& ct_body_id);
 
@@ -12,6 +12,10 @@
 // Authors: Hammad Mazhar, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
+#include <thrust/sort.h>
+
 #include "chrono_multicore/solver/ChIterativeSolverMulticore.h"
 
 using namespace chrono;
@@ -59,6 +63,10 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
     data_manager->host_data.gamma.resize(data_manager->num_constraints);
     data_manager->host_data.gamma.reset();
 
+    // Initialize impulses of persistent contacts from previous step
+    if (data_manager->settings.solver.warm_start)
+        WarmStartContacts();
+
     // Perform any setup tasks for all constraint types
     data_manager->rigid_rigid->Setup(data_manager);
     data_manager->bilateral->Setup(data_manager);
@@ -177,6 +185,11 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
     data_manager->system_timer.stop("ChIterativeSolverMulticore_Solve");
 
     ComputeImpulses();
+
+    // Cache contact impulses for warm-starting the next step
+    if (data_manager->settings.solver.warm_start)
+        CacheContactImpulses();
+
     for (int i = 0; i < data_manager->measures.solver.maxd_hist.size(); i++) {
         AtIterationEnd(data_manager->measures.solver.maxd_hist[i], data_manager->measures.solver.maxdeltalambda_hist[i],
                        i);
@@ -416,3 +429,84 @@ void ChIterativeSolverMulticoreNSC::ChangeSolverType(SolverType type) {
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+
+void ChIterativeSolverMulticoreNSC::WarmStartContacts() {
+    const uint num_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+    const custom_vector<long long>& prev_shapeIDs = data_manager->host_data.ws_shapeIDs;
+    const custom_vector<real>& prev_force = data_manager->host_data.ws_force;
+
+    if (num_contacts == 0 || prev_shapeIDs.empty())
+        return;
+
+    const std::vector<long long>& shapeIDs = data_manager->cd_data->contact_shapeIDs;
+    const SolverMode mode = data_manager->settings.solver.solver_mode;
+    const real step = data_manager->settings.step_size;
+    DynamicVector<real>& gamma = data_manager->host_data.gamma;
+
+    // Find the matching contact at the previous step (if any)
+    std::vector<int> prev_index;
+    MatchContactHistory(shapeIDs, num_contacts, prev_shapeIDs, prev_index);
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++) {
+        int j = prev_index[i];
+        if (j < 0)
+            continue;
+
+        const real* f = &prev_force[6 * j];
+        gamma[i] = step * f[0];
+        if (mode == SolverMode::SLIDING || mode == SolverMode::SPINNING) {
+            gamma[num_contacts + 2 * i + 0] = step * f[1];
+            gamma[num_contacts + 2 * i + 1] = step * f[2];
+        }
+        if (mode == SolverMode::SPINNING) {
+            gamma[3 * num_contacts + 3 * i + 0] = step * f[3];
+            gamma[3 * num_contacts + 3 * i + 1] = step * f[4];
+            gamma[3 * num_contacts + 3 * i + 2] = step * f[5];
+        }
+    }
+}
+
+void ChIterativeSolverMulticoreNSC::CacheContactImpulses() {
+    const uint num_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+    custom_vector<long long>& prev_shapeIDs = data_manager->host_data.ws_shapeIDs;
+    custom_vector<real>& prev_force = data_manager->host_data.ws_force;
+
+    prev_shapeIDs.resize(num_contacts);
+    prev_force.resize(6 * num_contacts);
+
+    if (num_contacts == 0)
+        return;
+
+    const std::vector<long long>& shapeIDs = data_manager->cd_data->contact_shapeIDs;
+    const SolverMode mode = data_manager->settings.solver.solver_mode;
+    const real inv_step = 1 / data_manager->settings.step_size;
+    const DynamicVector<real>& gamma = data_manager->host_data.gamma;
+
+    // Sort contacts by shape pair IDs (stable sort preserves the order of contacts with the same shape pair)
+    custom_vector<uint> order(num_contacts);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_contacts; i++)
+        order[i] = i;
+    std::copy(shapeIDs.begin(), shapeIDs.begin() + num_contacts, prev_shapeIDs.begin());
+    thrust::stable_sort_by_key(THRUST_PAR prev_shapeIDs.begin(), prev_shapeIDs.end(), order.begin());
+
+#pragma omp parallel for
+    for (int k = 0; k < (signed)num_contacts; k++) {
+        uint i = order[k];
+        real* f = &prev_force[6 * k];
+        f[0] = inv_step * gamma[i];
+        f[1] = f[2] = f[3] = f[4] = f[5] = 0;
+        if (mode == SolverMode::SLIDING || mode == SolverMode::SPINNING) {
+            f[1] = inv_step * gamma[num_contacts + 2 * i + 0];
+            f[2] = inv_step * gamma[num_contacts + 2 * i + 1];
+        }
+        if (mode == SolverMode::SPINNING) {
+            f[3] = inv_step * gamma[3 * num_contacts + 3 * i + 0];
+            f[4] = inv_step * gamma[3 * num_contacts + 3 * i + 1];
+            f[5] = inv_step * gamma[3 * num_contacts + 3 * i + 2];
+        }
+    }
+}
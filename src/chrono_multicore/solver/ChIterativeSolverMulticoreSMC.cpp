@@ -53,7 +53,6 @@ using namespace chrono;
 void function_CalcContactForces(
     int index,                                            // index of this contact pair
     vec2* body_pairs,                                     // indices of the body pair in contact
-    vec2* shape_pairs,                                    // indices of the shape pair in contact
     ChSystemSMC::ContactForceModel contact_model,         // contact force model
     ChSystemSMC::AdhesionForceModel adhesion_model,       // adhesion force model
     ChSystemSMC::TangentialDisplacementModel displ_mode,  // type of tangential displacement history
@@ -77,11 +76,14 @@ void function_CalcContactForces(
     real3* normal,                                        // contact normal (per contact)
     real* depth,                                          // penetration depth (per contact)
     real* eff_radius,                                     // effective contact radius (per contact)
-    vec3* shear_neigh,                                    // neighbor list of contacting bodies and shapes (per body)
-    char* shear_touch,                                    // flag if contact in neighbor list is persistent (per body)
-    real3* shear_disp,                                    // accumulated shear displacement for each neighbor (per body)
-    real* contact_relvel_init,                            // initial relative normal velocity per contact pair
-    real* contact_duration,                               // duration of persistent contact between contact pairs
+    int* shear_hist,                                      // index in contact history table (per contact)
+    const real3* hist_disp,                               // shear displacement (per history entry)
+    const real* hist_relvel_init,                         // initial relative normal velocity (per history entry)
+    const real* hist_duration,                            // duration of persistent contact (per history entry)
+    char* shear_touch,                                    // [output] flag if contact is active (per contact)
+    real3* shear_disp,                                    // [output] accumulated shear displacement (per contact)
+    real* contact_relvel_init,                            // [output] initial relative normal velocity (per contact)
+    real* contact_duration,                               // [output] duration of persistent contact (per contact)
     int* ct_bid,                                          // [output] body IDs (two per contact)
     real3* ct_force,                                      // [output] body force (two per contact)
     real3* ct_torque                                      // [output] body torque (two per contact)
@@ -172,78 +174,47 @@ void function_CalcContactForces(
     real delta_n = -depth[index];
     real3 delta_t = real3(0);
 
-    int i;
-    int contact_id = -1;
     int shear_body1 = -1;
-    int shear_body2;
-    int shear_shape1;
-    int shear_shape2;
-    bool newcontact = true;
 
     if (displ_mode == ChSystemSMC::TangentialDisplacementModel::OneStep) {
         delta_t = relvel_t * dT;
     } else if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
         delta_t = relvel_t * dT;
 
-        // Identify the two shapes in contact (global shape IDs).
-        int s1 = shape_pairs[index].x;
-        int s2 = shape_pairs[index].y;
-
-        // Contact history information stored on the body with the smaller shape or else the body with larger index.
-        // Currently, it is assumed that the smaller shape is on the body with larger ID. We call this body shear_body1.
+        // The shear displacement is stored relative to the body with larger index. We call this body shear_body1.
         shear_body1 = std::max(b1, b2);
-        shear_body2 = std::min(b1, b2);
-        shear_shape1 = std::max(s1, s2);
-        shear_shape2 = std::min(s1, s2);
-
-        // Check if contact history already exists. If not, initialize new contact history.
-        for (i = 0; i < max_shear; i++) {
-            int ctIdUnrolled = max_shear * shear_body1 + i;
-            if (shear_neigh[ctIdUnrolled].x == shear_body2 && shear_neigh[ctIdUnrolled].y == shear_shape1 &&
-                shear_neigh[ctIdUnrolled].z == shear_shape2) {
-                contact_duration[ctIdUnrolled] += dT;
-                contact_id = i;
-                newcontact = false;
-                break;
-            }
-        }
-        if (newcontact == true) {
-            for (i = 0; i < max_shear; i++) {
-                int ctIdUnrolled = max_shear * shear_body1 + i;
-                if (shear_neigh[ctIdUnrolled].x == -1) {
-                    contact_id = i;
-                    shear_neigh[ctIdUnrolled].x = shear_body2;
-                    shear_neigh[ctIdUnrolled].y = shear_shape1;
-                    shear_neigh[ctIdUnrolled].z = shear_shape2;
-                    shear_disp[ctIdUnrolled].x = 0;
-                    shear_disp[ctIdUnrolled].y = 0;
-                    shear_disp[ctIdUnrolled].z = 0;
-                    contact_relvel_init[ctIdUnrolled] = relvel_init;
-                    contact_duration[ctIdUnrolled] = 0;
-                    break;
-                }
-            }
+
+        // Load the contact history, if it exists. Otherwise, initialize new contact history.
+        int hist = shear_hist[index];
+        real3 disp(0);
+        if (hist >= 0) {
+            disp = hist_disp[hist];
+            contact_relvel_init[index] = hist_relvel_init[hist];
+            contact_duration[index] = hist_duration[hist] + dT;
+        } else {
+            contact_relvel_init[index] = relvel_init;
+            contact_duration[index] = 0;
         }
 
-        // Record that these two bodies are really in contact at this time.
-        int ctSaveId = max_shear * shear_body1 + contact_id;
-        shear_touch[ctSaveId] = true;
+        // Record that these two shapes are really in contact at this time.
+        shear_touch[index] = true;
 
         // Increment stored contact history tangential (shear) displacement vector and project it onto the current
         // contact plane.
         if (shear_body1 == b1) {
-            shear_disp[ctSaveId] += delta_t;
-            shear_disp[ctSaveId] -= Dot(shear_disp[ctSaveId], normal[index]) * normal[index];
-            delta_t = shear_disp[ctSaveId];
+            disp += delta_t;
+            disp -= Dot(disp, normal[index]) * normal[index];
+            delta_t = disp;
         } else {
-            shear_disp[ctSaveId] -= delta_t;
-            shear_disp[ctSaveId] -= Dot(shear_disp[ctSaveId], normal[index]) * normal[index];
-            delta_t = -shear_disp[ctSaveId];
+            disp -= delta_t;
+            disp -= Dot(disp, normal[index]) * normal[index];
+            delta_t = -disp;
         }
+        shear_disp[index] = disp;
 
         // Load the initial collision velocity and accumulated contact duration from the contact history.
-        relvel_init = (contact_relvel_init[ctSaveId] < char_vel) ? char_vel : contact_relvel_init[ctSaveId];
-        t_contact = contact_duration[ctSaveId];
+        relvel_init = (contact_relvel_init[index] < char_vel) ? char_vel : contact_relvel_init[index];
+        t_contact = contact_duration[index];
     }
 
     auto eps = std::numeric_limits<double>::epsilon();
@@ -457,11 +428,7 @@ void function_CalcContactForces(
             forceT *= ratio;
             if (displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
                 delta_t = (forceT - forceT_damp) / kt;
-                if (shear_body1 == b1) {
-                    shear_disp[max_shear * shear_body1 + contact_id] = delta_t;
-                } else {
-                    shear_disp[max_shear * shear_body1 + contact_id] = -delta_t;
-                }
+                shear_disp[index] = (shear_body1 == b1) ? delta_t : -delta_t;
             }
         } else {
             forceT = real3(0);
@@ -555,14 +522,16 @@ void function_CalcContactForces(
 void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& ct_bid,
                                                            custom_vector<real3>& ct_force,
                                                            custom_vector<real3>& ct_torque,
-                                                           custom_vector<vec2>& shape_pairs,
-                                                           custom_vector<char>& shear_touch) {
+                                                           custom_vector<int>& shear_hist,
+                                                           custom_vector<char>& shear_touch,
+                                                           custom_vector<real3>& shear_disp,
+                                                           custom_vector<real>& contact_relvel_init,
+                                                           custom_vector<real>& contact_duration) {
 #pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->cd_data->num_rigid_contacts; index++) {
         function_CalcContactForces(
             index,                                                  // index of this contact pair
             data_manager->cd_data->bids_rigid_rigid.data(),         // indices of the body pair in contact
-            shape_pairs.data(),                                     // indices of the shape pair in contact
             data_manager->settings.solver.contact_force_model,      // contact force model
             data_manager->settings.solver.adhesion_force_model,     // adhesion force model
             data_manager->settings.solver.tangential_displ_mode,    // type of tangential displacement history
@@ -586,11 +555,14 @@ void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& c
             data_manager->cd_data->norm_rigid_rigid.data(),         // contact normal (per contact)
             data_manager->cd_data->dpth_rigid_rigid.data(),         // penetration depth (per contact)
             data_manager->cd_data->erad_rigid_rigid.data(),         // effective contact radius (per contact)
-            data_manager->host_data.shear_neigh.data(),  // neighbor list of contacting bodies and shapes (per body)
-            shear_touch.data(),                          // flag if contact in neighbor list is persistent (per body)
-            data_manager->host_data.shear_disp.data(),   // accumulated shear displacement for each neighbor (per body)
-            data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity per contact pair
-            data_manager->host_data.contact_duration.data(),     // duration of persistent contact between contact pairs
+            shear_hist.data(),                                   // index in contact history table (per contact)
+            data_manager->host_data.shear_disp.data(),           // shear displacement (per history entry)
+            data_manager->host_data.contact_relvel_init.data(),  // initial relative normal velocity (per history entry)
+            data_manager->host_data.contact_duration.data(),     // duration of persistent contact (per history entry)
+            shear_touch.data(),                                  // [output] flag if contact is active (per contact)
+            shear_disp.data(),                                   // [output] shear displacement (per contact)
+            contact_relvel_init.data(),                          // [output] initial relative normal velocity
+            contact_duration.data(),                             // [output] duration of persistent contact
             ct_bid.data(),                                       // [output] body IDs (two per contact)
             ct_force.data(),                                     // [output] body force (two per contact)
             ct_torque.data()                                     // [output] body torque (two per contact)
@@ -598,6 +570,54 @@ void ChIterativeSolverMulticoreSMC::host_CalcContactForces(custom_vector<int>& c
     }
 }
 
+// -----------------------------------------------------------------------------
+// Contact shear history (MultiStep tangential displacement model).
+// The history table holds one entry per contact active at the previous step,
+// sorted by shape pair key. Several contacts between the same pair of shapes
+// are matched in the order in which they are reported by the narrowphase.
+// -----------------------------------------------------------------------------
+void ChIterativeSolverMulticoreSMC::host_MatchContactHistory(custom_vector<int>& shear_hist) {
+    const uint num_contacts = data_manager->cd_data->num_rigid_contacts;
+    const std::vector<long long>& shapeIDs = data_manager->cd_data->contact_shapeIDs;
+    MatchContactHistory(shapeIDs, num_contacts, data_manager->host_data.shear_keys, shear_hist);
+}
+
+void ChIterativeSolverMulticoreSMC::host_UpdateContactHistory(const custom_vector<char>& shear_touch,
+                                                              const custom_vector<real3>& shear_disp,
+                                                              const custom_vector<real>& contact_relvel_init,
+                                                              const custom_vector<real>& contact_duration) {
+    const uint num_contacts = data_manager->cd_data->num_rigid_contacts;
+    const std::vector<long long>& shapeIDs = data_manager->cd_data->contact_shapeIDs;
+    host_container& hd = data_manager->host_data;
+
+    // Collect the active contacts and sort them by shape pair key. The sort is stable so that contacts between the
+    // same pair of shapes keep the narrowphase order used in host_MatchContactHistory.
+    custom_vector<uint> order;
+    order.reserve(num_contacts);
+    for (uint i = 0; i < num_contacts; i++) {
+        if (shear_touch[i])
+            order.push_back(i);
+    }
+    const int num_hist = (int)order.size();
+
+    hd.shear_keys.resize(num_hist);
+#pragma omp parallel for
+    for (int k = 0; k < num_hist; k++) {
+        hd.shear_keys[k] = shapeIDs[order[k]];
+    }
+    thrust::stable_sort_by_key(THRUST_PAR hd.shear_keys.begin(), hd.shear_keys.end(), order.begin());
+
+    hd.shear_disp.resize(num_hist);
+    hd.contact_relvel_init.resize(num_hist);
+    hd.contact_duration.resize(num_hist);
+#pragma omp parallel for
+    for (int k = 0; k < num_hist; k++) {
+        hd.shear_disp[k] = shear_disp[order[k]];
+        hd.contact_relvel_init[k] = contact_relvel_init[order[k]];
+        hd.contact_duration[k] = contact_duration[order[k]];
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Include contact impulses (linear and rotational) for all bodies that are
 // involved in at least one contact. For each such body, the corresponding
@@ -660,35 +680,33 @@ void ChIterativeSolverMulticoreSMC::ProcessContacts() {
     custom_vector<real3> ct_torque(2 * num_rigid_contacts);
 
     // Set up additional vectors for multi-step tangential model
-    custom_vector<vec2> shape_pairs;
+    bool multi_step =
+        data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep;
+    custom_vector<int> shear_hist;
     custom_vector<char> shear_touch;
-    if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-        shape_pairs.resize(num_rigid_contacts);
-        shear_touch.resize(max_shear * data_manager->num_rigid_bodies);
+    custom_vector<real3> shear_disp;
+    custom_vector<real> contact_relvel_init;
+    custom_vector<real> contact_duration;
+    if (multi_step) {
+        shear_hist.resize(num_rigid_contacts);
+        shear_touch.resize(num_rigid_contacts);
+        shear_disp.resize(num_rigid_contacts);
+        contact_relvel_init.resize(num_rigid_contacts);
+        contact_duration.resize(num_rigid_contacts);
         Thrust_Fill(shear_touch, false);
-#pragma omp parallel for
-        for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-            vec2 pair = I2(int(data_manager->cd_data->contact_shapeIDs[i] >> 32),
-                           int(data_manager->cd_data->contact_shapeIDs[i] & 0xffffffff));
-            shape_pairs[i] = pair;
-        }
+        host_MatchContactHistory(shear_hist);
     }
 
-    host_CalcContactForces(ct_bid, ct_force, ct_torque, shape_pairs, shear_touch);
+    host_CalcContactForces(ct_bid, ct_force, ct_torque, shear_hist, shear_touch, shear_disp, contact_relvel_init,
+                           contact_duration);
 
     data_manager->host_data.ct_force.resize(2 * num_rigid_contacts);
     data_manager->host_data.ct_torque.resize(2 * num_rigid_contacts);
     thrust::copy(THRUST_PAR ct_force.begin(), ct_force.end(), data_manager->host_data.ct_force.begin());
     thrust::copy(THRUST_PAR ct_torque.begin(), ct_torque.end(), data_manager->host_data.ct_torque.begin());
 
-    if (data_manager->settings.solver.tangential_displ_mode == ChSystemSMC::TangentialDisplacementModel::MultiStep) {
-#pragma omp parallel for
-        for (int index = 0; index < (signed)data_manager->num_rigid_bodies; index++) {
-            for (int i = 0; i < max_shear; i++) {
-                if (shear_touch[max_shear * index + i] == false)
-                    data_manager->host_data.shear_neigh[max_shear * index + i].x = -1;
-            }
-        }
+    if (multi_step) {
+        host_UpdateContactHistory(shear_touch, shear_disp, contact_relvel_init, contact_duration);
     }
 
     // 2. Calculate contact forces and torques - per body basis
@@ -802,6 +820,12 @@ void ChIterativeSolverMulticoreSMC::RunTimeStep() {
         data_manager->system_timer.start("ChIterativeSolverMulticoreSMC_ProcessContact");
         ProcessContacts();
         data_manager->system_timer.stop("ChIterativeSolverMulticoreSMC_ProcessContact");
+    } else {
+        // No contacts at this step, so there is no contact history to carry over
+        data_manager->host_data.shear_keys.clear();
+        data_manager->host_data.shear_disp.clear();
+        data_manager->host_data.contact_relvel_init.clear();
+        data_manager->host_data.contact_duration.clear();
     }
 
     // Generate the mass matrix and compute M_inv_k
@@ -21,11 +21,29 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(unsigned int num_threads) {
     mkl_set_num_threads(num_threads);
 }
 
+ChSolverPardisoMKL* ChSolverPardisoMKL::Clone() const {
+    auto solver = new ChSolverPardisoMKL(mkl_get_max_threads());
+    solver->CopySettings(*this);
+    solver->m_engine.pardisoParameterArray() =
+        const_cast<Eigen::PardisoLU<ChSparseMatrix>&>(m_engine).pardisoParameterArray();
+    return solver;
+}
+
 bool ChSolverPardisoMKL::FactorizeMatrix() {
     m_engine.compute(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
+bool ChSolverPardisoMKL::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
+bool ChSolverPardisoMKL::FactorizeMatrixNumeric() {
+    m_engine.factorize(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverPardisoMKL::SolveSystem() {
     m_sol = m_engine.solve(m_rhs);
     return (m_engine.info() == Eigen::Success);
@@ -55,6 +73,15 @@ ChSolverComplexPardisoMKL::ChSolverComplexPardisoMKL(unsigned int num_threads) {
     mkl_set_num_threads(num_threads);
 }
 
+ChSolverComplexPardisoMKL* ChSolverComplexPardisoMKL::Clone() const {
+    auto solver = new ChSolverComplexPardisoMKL(mkl_get_max_threads());
+    solver->verbose = verbose;
+    solver->m_engine.pardisoParameterArray() =
+        const_cast<Eigen::PardisoLU<Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor>>&>(m_engine)
+            .pardisoParameterArray();
+    return solver;
+}
+
 bool ChSolverComplexPardisoMKL::FactorizeMatrix() {
     m_engine.compute(m_mat);
     return (m_engine.info() == Eigen::Success);
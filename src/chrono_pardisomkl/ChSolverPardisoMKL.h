@@ -64,10 +64,22 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     /// Get a handle to the underlying MKL engine.
     Eigen::PardisoLU<ChSparseMatrix>& GetMklEngine() { return m_engine; }
 
+    /// Create a new Pardiso solver with the same settings (including the Pardiso parameters), without factorization.
+    virtual ChSolverPardisoMKL* Clone() const override;
+
   private:
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
+    /// Symbolic analysis and numeric factorization can be performed separately.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Perform the numeric factorization of the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrixNumeric() override;
+
     /// Solve the linear system using the current factorization and right-hand side vector.
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveSystem() override;
@@ -88,6 +100,9 @@ class ChApiPardisoMKL ChSolverComplexPardisoMKL : public ChDirectSolverLScomplex
     /// Get a handle to the underlying MKL engine.
     Eigen::PardisoLU<Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor>>& GetMklEngine() { return m_engine; }
 
+    /// Create a new Pardiso solver with the same settings (including the Pardiso parameters), without factorization.
+    virtual ChSolverComplexPardisoMKL* Clone() const override;
+
   private:
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
@@ -1,5 +1,7 @@
 #include "chrono_synchrono/SynChronoManager.h"
 
+#include <algorithm>
+
 #include "chrono_synchrono/SynConfig.h"
 #include "chrono_synchrono/utils/SynLog.h"
 #include "chrono_synchrono/agent/SynAgentFactory.h"
@@ -50,6 +52,7 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
       m_node_key(node_id, 0),
       m_heartbeat(1e-2),
       m_next_sync(0.0),
+      m_interest_radius(0),
       m_time_update(0),
       m_time_msg_gather(0),
       m_time_communication(0),
@@ -134,6 +137,12 @@ bool SynChronoManager::Initialize(ChSystem* system) {
     // Initialize the communicator
     m_communicator->Initialize();
 
+    // Description messages are exchanged all-to-all, since no region of interest is set at this point
+    if (m_interest_radius > 0 && !m_communicator->EnableInterestManagement(true)) {
+        SynLog() << "WARNING: The communicator does not support interest management. Exchanging messages with "
+                    "all nodes.\n";
+    }
+
 #ifdef CHRONO_FASTDDS
     // If the communicator uses DDS, we want to create subscribers that will listen to state information
     // coming from the other nodes. This is done by setting the name of each governing participant to
@@ -193,6 +202,8 @@ void SynChronoManager::Synchronize(double time) {
     // Gather messages from each node and add those to the communicator
     // Only add the messages to the communicator which is responsible for commuticating with that node
     m_timer_msg_gather.start();
+    if (m_communicator->IsInterestManagementEnabled())
+        UpdateInterestRegion();
     SynMessageList messages = GatherMessages();
     m_communicator->AddOutgoingMessages(messages);
     m_timer_msg_gather.stop();
@@ -241,6 +252,13 @@ void SynChronoManager::PrintStepStatistics(std::ostream& os) const {
     os << "   Msg. generation: " << 1e3 * m_timer_msg_gather() << "  [" << m_time_msg_gather << "]" << std::endl;
     os << "   Communication:   " << 1e3 * m_timer_communication() << "  [" << m_time_communication << "]" << std::endl;
     os << "   Msg. processing: " << 1e3 * m_timer_msg_process() << "  [" << m_time_msg_process << "]" << std::endl;
+    if (m_communicator) {
+        os << " Traffic (bytes [total]):" << std::endl;
+        os << "   Sent:            " << m_communicator->GetBytesSent() << "  [" << m_communicator->GetTotalBytesSent()
+           << "]" << std::endl;
+        os << "   Received:        " << m_communicator->GetBytesReceived() << "  ["
+           << m_communicator->GetTotalBytesReceived() << "]" << std::endl;
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------
@@ -303,6 +321,32 @@ void SynChronoManager::DistributeMessages() {
     }
 }
 
+void SynChronoManager::UpdateInterestRegion() {
+    // Bounding sphere (around the centroid) of all agents on this node that report a location
+    std::vector<ChVector3d> locations;
+    ChVector3d pos;
+    for (auto& agent_pair : m_agents) {
+        if (agent_pair.second->GetLocation(pos))
+            locations.push_back(pos);
+    }
+
+    if (locations.empty()) {
+        m_communicator->ClearInterestRegion();
+        return;
+    }
+
+    ChVector3d center(0, 0, 0);
+    for (const auto& loc : locations)
+        center += loc;
+    center /= (double)locations.size();
+
+    double extent = 0;
+    for (const auto& loc : locations)
+        extent = std::max(extent, (loc - center).Length());
+
+    m_communicator->SetInterestRegion(center, extent, m_interest_radius);
+}
+
 void SynChronoManager::CreateAgentsFromDescriptions() {
     for (auto& message_agent_pair : m_messages) {
         // For readibility
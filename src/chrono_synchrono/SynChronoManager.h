@@ -83,6 +83,16 @@ class SYN_API SynChronoManager {
     ///
     void SetHeartbeat(double heartbeat) { m_heartbeat = heartbeat; }
 
+    ///@brief Enable spatial interest management with the given interest radius (default: 0, all-to-all exchange).
+    /// If enabled, state messages are only exchanged with nodes that have agents within the interest radius of an
+    /// agent on this node. Zombies of agents out of range are not updated and keep their last received state.
+    /// Terrain deformations (SCM messages carry only the nodes modified since the last message) are still sent to all
+    /// nodes, so that a node coming back in range has the full deformed terrain.
+    /// Must be called before Initialize, with the same setting on all nodes. Requires a communicator supporting
+    /// interest management (currently only MPI); otherwise, a warning is issued and all-to-all exchange is used.
+    ///
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
@@ -135,6 +145,10 @@ class SYN_API SynChronoManager {
     ///
     void CreateAgentsFromDescriptions();
 
+    ///@brief Update the region of interest of this node from the current location of its agents
+    ///
+    void UpdateInterestRegion();
+
     // --------------------------------------------------------------------------------------------------------------
 
     bool m_is_ok;
@@ -146,6 +160,8 @@ class SYN_API SynChronoManager {
     double m_heartbeat;  ///< Rate at which synchronization between nodes occurs
     double m_next_sync;  ///< Time at which next synchronization between nodes should occur
 
+    double m_interest_radius;  ///< Radius for spatial interest management (0: exchange with all nodes)
+
     ChTimer m_timer_update;         ///< timer for agent updates
     ChTimer m_timer_msg_gather;     ///< timer for generating outgoing messages
     ChTimer m_timer_communication;  ///< timer for communication
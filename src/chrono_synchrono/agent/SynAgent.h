@@ -87,6 +87,12 @@ class SYN_API SynAgent {
     ///@param zombie the new zombie
     virtual void RegisterZombie(std::shared_ptr<SynAgent> zombie) {}
 
+    ///@brief Get the current location of this agent, used for range-based interest management.
+    /// Agents without a meaningful location (e.g. terrain or environment agents) return false.
+    ///
+    ///@param pos the location of the agent, expressed in the absolute frame
+    virtual bool GetLocation(ChVector3d& pos) const { return false; }
+
     // -------------------------------------------------------------------------
 
     void SetProcessMessageCallback(std::function<void(std::shared_ptr<SynMessage>)> callback);
@@ -95,6 +95,15 @@ class SYN_API SynCopterAgent : public SynAgent {
     ///
     virtual void SetKey(AgentKey agent_key) override;
 
+    ///@brief Get the current location of the wrapped copter (lead agents only)
+    ///
+    virtual bool GetLocation(ChVector3d& pos) const override {
+        if (!m_copter)
+            return false;
+        pos = m_copter->GetChassis()->GetPos();
+        return true;
+    }
+
     // ------------------------------------------------------------------------
 
   protected:
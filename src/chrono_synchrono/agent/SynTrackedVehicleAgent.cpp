@@ -32,7 +32,7 @@ namespace chrono {
 namespace synchrono {
 
 SynTrackedVehicleAgent::SynTrackedVehicleAgent(ChTrackedVehicle* vehicle, const std::string& filename)
-    : SynAgent(), m_vehicle(vehicle) {
+    : SynAgent(), m_vehicle(vehicle), m_compression(false) {
     m_state = chrono_types::make_shared<SynTrackedVehicleStateMessage>();
     m_description = chrono_types::make_shared<SynTrackedVehicleDescriptionMessage>();
 
@@ -67,6 +67,23 @@ void SynTrackedVehicleAgent::InitializeZombie(ChSystem* system) {
 void SynTrackedVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
         m_zombie_body->SetFrameRefToAbs(state->chassis.GetFrame());
+
+        if (!state->compressed.IsEmpty()) {
+            // Component poses are not updated until a keyframe was received
+            std::vector<SynPose> poses;
+            if (m_codec.Decode(state->chassis.GetFrame(), state->compressed, poses)) {
+                // Components are encoded in order: track shoes, sprockets, idlers, road wheels
+                size_t k = 0;
+                for (auto list : {&m_track_shoe_list, &m_sprocket_list, &m_idler_list, &m_road_wheel_list}) {
+                    for (auto& body : *list) {
+                        if (k < poses.size())
+                            body->SetFrameRefToAbs(poses[k++].GetFrame());
+                    }
+                }
+            }
+            return;
+        }
+
         for (int i = 0; i < state->track_shoes.size(); i++)
             m_track_shoe_list[i]->SetFrameRefToAbs(state->track_shoes[i].GetFrame());
         for (int i = 0; i < state->sprockets.size(); i++)
@@ -113,7 +130,19 @@ void SynTrackedVehicleAgent::Update() {
         road_wheels.emplace_back(right_assembly->GetRoadWheel(i)->GetBody()->GetFrameRefToAbs());
 
     auto time = m_vehicle->GetSystem()->GetChTime();
-    m_state->SetState(time, chassis, track_shoes, sprockets, idlers, road_wheels);
+    if (m_compression) {
+        std::vector<SynPose> poses;
+        poses.reserve(track_shoes.size() + sprockets.size() + idlers.size() + road_wheels.size());
+        poses.insert(poses.end(), track_shoes.begin(), track_shoes.end());
+        poses.insert(poses.end(), sprockets.begin(), sprockets.end());
+        poses.insert(poses.end(), idlers.begin(), idlers.end());
+        poses.insert(poses.end(), road_wheels.begin(), road_wheels.end());
+        m_codec.Encode(chassis.GetFrame(), poses, m_state->compressed);
+        m_state->SetState(time, chassis, {}, {}, {}, {});
+    } else {
+        m_state->compressed = SynCompressedPoses();
+        m_state->SetState(time, chassis, track_shoes, sprockets, idlers, road_wheels);
+    }
 }
 
 // ------------------------------------------------------------------------
@@ -123,6 +123,26 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     ///
     virtual void SetKey(AgentKey agent_key) override;
 
+    ///@brief Get the current location of the wrapped vehicle (lead agents only)
+    ///
+    virtual bool GetLocation(ChVector3d& pos) const override {
+        if (!m_vehicle)
+            return false;
+        pos = m_vehicle->GetPos();
+        return true;
+    }
+
+    ///@brief Enable compression of the component poses in state messages (default: false)
+    /// Poses of track shoes, sprockets, idlers, and road wheels are quantized relative to the chassis frame and
+    /// delta-encoded against periodic keyframes (see SynPoseCodec). Only relevant for the lead agent; zombies decode
+    /// compressed messages automatically.
+    ///
+    void EnableStateCompression(bool val) { m_compression = val; }
+
+    ///@brief Get the codec used for compressing state messages (e.g., to change resolution or keyframe interval)
+    ///
+    SynPoseCodec& GetStateCodec() { return m_codec; }
+
     // ------------------------------------------------------------------------
 
   private:
@@ -173,6 +193,9 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_sprocket_list;    ///< vector of this agent's zombie sprockets
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_idler_list;       ///< vector of this agent's zombie idlers
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_road_wheel_list;  ///< vector of this agent's zombie road wheels
+
+    bool m_compression;    ///< compress the component poses in state messages?
+    SynPoseCodec m_codec;  ///< encoder (lead agent) or decoder (zombie) of compressed component poses
 };
 
 /// @} synchrono_agent
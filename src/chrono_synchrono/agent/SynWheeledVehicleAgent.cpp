@@ -33,7 +33,7 @@ namespace chrono {
 namespace synchrono {
 
 SynWheeledVehicleAgent::SynWheeledVehicleAgent(ChWheeledVehicle* vehicle, const std::string& filename)
-    : SynAgent(), m_vehicle(vehicle) {
+    : SynAgent(), m_vehicle(vehicle), m_compression(false) {
     m_state = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(), AgentKey());
     m_description = chrono_types::make_shared<SynWheeledVehicleDescriptionMessage>();
 
@@ -81,6 +81,17 @@ void SynWheeledVehicleAgent::InitializeZombie(ChSystem* system) {
 void SynWheeledVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
         m_zombie_body->SetFrameRefToAbs(state->chassis.GetFrame());
+
+        if (!state->compressed.IsEmpty()) {
+            // Wheel poses are not updated until a keyframe was received
+            std::vector<SynPose> wheels;
+            if (m_codec.Decode(state->chassis.GetFrame(), state->compressed, wheels)) {
+                for (size_t i = 0; i < wheels.size() && i < m_wheel_list.size(); i++)
+                    m_wheel_list[i]->SetFrameRefToAbs(wheels[i].GetFrame());
+            }
+            return;
+        }
+
         for (int i = 0; i < state->wheels.size(); i++)
             m_wheel_list[i]->SetFrameRefToAbs(state->wheels[i].GetFrame());
     }
@@ -112,7 +123,13 @@ void SynWheeledVehicleAgent::Update() {
     }
 
     auto time = m_vehicle->GetSystem()->GetChTime();
-    m_state->SetState(time, chassis, wheels);
+    if (m_compression) {
+        m_codec.Encode(chassis.GetFrame(), wheels, m_state->compressed);
+        m_state->SetState(time, chassis, {});
+    } else {
+        m_state->compressed = SynCompressedPoses();
+        m_state->SetState(time, chassis, wheels);
+    }
 }
 
 // ------------------------------------------------------------------------
@@ -105,6 +105,25 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///
     virtual void SetKey(AgentKey agent_key) override;
 
+    ///@brief Get the current location of the wrapped vehicle (lead agents only)
+    ///
+    virtual bool GetLocation(ChVector3d& pos) const override {
+        if (!m_vehicle)
+            return false;
+        pos = m_vehicle->GetPos();
+        return true;
+    }
+
+    ///@brief Enable compression of the wheel poses in state messages (default: false)
+    /// Wheel poses are quantized relative to the chassis frame and delta-encoded against periodic keyframes (see
+    /// SynPoseCodec). Only relevant for the lead agent; zombies decode compressed messages automatically.
+    ///
+    void EnableStateCompression(bool val) { m_compression = val; }
+
+    ///@brief Get the codec used for compressing state messages (e.g., to change resolution or keyframe interval)
+    ///
+    SynPoseCodec& GetStateCodec() { return m_codec; }
+
     // ------------------------------------------------------------------------
 
   protected:
@@ -130,6 +149,9 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
 
     std::shared_ptr<ChBodyAuxRef> m_zombie_body;              ///< agent's zombie body reference
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_wheel_list;  ///< vector of this agent's zombie wheels
+
+    bool m_compression;    ///< compress the wheel poses in state messages?
+    SynPoseCodec m_codec;  ///< encoder (lead agent) or decoder (zombie) of compressed wheel poses
 };
 
 /// @} synchrono_agent
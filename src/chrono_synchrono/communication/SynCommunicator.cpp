@@ -22,12 +22,24 @@
 // =============================================================================
 
 #include "chrono_synchrono/communication/SynCommunicator.h"
+#include "chrono_synchrono/flatbuffer/message/SynSCMMessage.h"
 #include "chrono_synchrono/flatbuffer/message/SynSimulationMessage.h"
 
 namespace chrono {
 namespace synchrono {
 
-SynCommunicator::SynCommunicator() : m_initialized(false) {}
+SynCommunicator::SynCommunicator()
+    : m_initialized(false),
+      m_interest_enabled(false),
+      m_has_region(false),
+      m_region_extent(0),
+      m_interest_radius(0),
+      m_broadcast(false),
+      m_bytes_sent(0),
+      m_bytes_received(0),
+      m_total_bytes_sent(0),
+      m_total_bytes_received(0),
+      m_pending_bytes_received(0) {}
 
 SynCommunicator::~SynCommunicator() {}
 
@@ -42,14 +54,23 @@ void SynCommunicator::Reset() {
 }
 
 void SynCommunicator::AddOutgoingMessages(SynMessageList& messages) {
-    for (auto message : messages)
+    for (auto message : messages) {
         m_flatbuffers_manager.AddMessage(message);
+
+        // SCM messages only carry the nodes modified since the last message, so a node that misses one would lose
+        // these deformations for good. Send them to every node.
+        if (auto scm_message = std::dynamic_pointer_cast<SynSCMMessage>(message)) {
+            if (!scm_message->modified_nodes.empty())
+                m_broadcast = true;
+        }
+    }
 }
 
 void SynCommunicator::AddQuitMessage() {
     // Source and destination are meaningless in this case
     auto message = chrono_types::make_shared<SynSimulationMessage>(AgentKey(), AgentKey(), true);
     m_flatbuffers_manager.AddMessage(message);
+    m_broadcast = true;
 }
 
 void SynCommunicator::AddIncomingMessages(SynMessageList& messages) {
@@ -58,10 +79,32 @@ void SynCommunicator::AddIncomingMessages(SynMessageList& messages) {
 }
 
 void SynCommunicator::ProcessBuffer(std::vector<uint8_t>& data) {
+    m_pending_bytes_received += data.size();
     m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
 }
 
 // -----------------------------------------------------------------------------------------------
 
+bool SynCommunicator::EnableInterestManagement(bool val) {
+    m_interest_enabled = false;
+    return !val;
+}
+
+void SynCommunicator::RecordTraffic(size_t sent, size_t received) {
+    m_bytes_sent = sent;
+    m_bytes_received = received;
+    m_total_bytes_sent += sent;
+    m_total_bytes_received += received;
+}
+
+void SynCommunicator::SetInterestRegion(const ChVector3d& center, double extent, double radius) {
+    m_has_region = true;
+    m_region_center = center;
+    m_region_extent = extent;
+    m_interest_radius = radius;
+}
+
+// -----------------------------------------------------------------------------------------------
+
 }  // namespace synchrono
 }  // namespace chrono
\ No newline at end of file
@@ -29,6 +29,8 @@
 #include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
 
+#include "chrono/core/ChVector3.h"
+
 #include <vector>
 #include <functional>
 
@@ -101,9 +103,69 @@ class SYN_API SynCommunicator {
 
     // -----------------------------------------------------------------------------------------------
 
+    ///@brief Enable or disable spatial interest management.
+    /// If enabled, state data is only exchanged between nodes whose regions of interest overlap (see
+    /// SetInterestRegion), instead of all-to-all. Nodes without a region, as well as broadcast data (quit
+    /// messages and SCM terrain deformations), are still exchanged with every node. Must be enabled on all nodes or none.
+    ///
+    ///@return false if the communicator does not support interest management (the default)
+    virtual bool EnableInterestManagement(bool val);
+
+    ///@brief Set the region of interest of this node.
+    /// The region is a sphere of radius 'extent' around 'center' enclosing all agents on this node. Data is
+    /// exchanged with another node if the two regions are closer than the largest interest radius of the two nodes.
+    ///
+    void SetInterestRegion(const ChVector3d& center, double extent, double radius);
+
+    ///@brief Clear the region of interest of this node (data is exchanged with all nodes).
+    ///
+    void ClearInterestRegion() { m_has_region = false; }
+
+    ///@brief Return true if interest management is enabled.
+    ///
+    bool IsInterestManagementEnabled() const { return m_interest_enabled; }
+
+    // -----------------------------------------------------------------------------------------------
+
+    ///@brief Get the number of message bytes sent by this node at the last synchronization step.
+    /// Data sent to multiple nodes is counted once for each destination.
+    ///
+    size_t GetBytesSent() const { return m_bytes_sent; }
+
+    ///@brief Get the number of message bytes received by this node at the last synchronization step
+    ///
+    size_t GetBytesReceived() const { return m_bytes_received; }
+
+    ///@brief Get the cumulative number of message bytes sent by this node
+    ///
+    size_t GetTotalBytesSent() const { return m_total_bytes_sent; }
+
+    ///@brief Get the cumulative number of message bytes received by this node
+    ///
+    size_t GetTotalBytesReceived() const { return m_total_bytes_received; }
+
+    // -----------------------------------------------------------------------------------------------
+
   protected:
     bool m_initialized;  ///< whether the communicator has been initialized
 
+    bool m_interest_enabled;     ///< is spatial interest management enabled?
+    bool m_has_region;           ///< has a region of interest been set for this node?
+    ChVector3d m_region_center;  ///< center of the region of interest
+    double m_region_extent;      ///< radius of the region enclosing the agents on this node
+    double m_interest_radius;    ///< interest radius around the region
+    bool m_broadcast;            ///< outgoing data must be sent to all nodes (reset after each exchange)
+
+    ///@brief Record the number of message bytes sent and received at the current synchronization step
+    ///
+    void RecordTraffic(size_t sent, size_t received);
+
+    size_t m_bytes_sent;              ///< bytes sent at last synchronization step
+    size_t m_bytes_received;          ///< bytes received at last synchronization step
+    size_t m_total_bytes_sent;        ///< cumulative bytes sent
+    size_t m_total_bytes_received;    ///< cumulative bytes received
+    size_t m_pending_bytes_received;  ///< bytes received through ProcessBuffer since last synchronization step
+
     SynMessageList m_incoming_messages;           ///< Incoming messages
     SynFlatBuffersManager m_flatbuffers_manager;  ///< flatbuffer manager for this rank
 };
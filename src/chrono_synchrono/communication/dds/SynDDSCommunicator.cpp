@@ -125,12 +125,16 @@ void SynDDSCommunicator::Initialize() {
 void SynDDSCommunicator::Synchronize() {
     // Complete the buffer
     m_flatbuffers_manager.Finish();
+    size_t bytes_sent = m_flatbuffers_manager.GetSize() * m_publishers.size();
 
     // Publish data
     Publish();
 
     // Blocking wait for a message to be received
     Listen();
+
+    RecordTraffic(bytes_sent, m_pending_bytes_received);
+    m_pending_bytes_received = 0;
 }
 
 void SynDDSCommunicator::Barrier() {
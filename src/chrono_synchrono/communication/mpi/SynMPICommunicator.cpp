@@ -21,11 +21,17 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
 
 namespace chrono {
 namespace synchrono {
 
+// Layout of the region record exchanged by each rank when interest management is enabled
+enum RegionRecord { REC_X, REC_Y, REC_Z, REC_EXTENT, REC_RADIUS, REC_LENGTH, REC_FLAGS, REC_SIZE };
+enum RegionFlags { FLAG_REGION = 1, FLAG_BROADCAST = 2 };
+
 SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
     // mpi initialization
     MPI_Init(&argc, &argv);
@@ -38,6 +44,7 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+    m_num_peers = m_num_ranks - 1;
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
@@ -52,6 +59,13 @@ void SynMPICommunicator::Synchronize() {
 
     int msg_length = m_flatbuffers_manager.GetSize();
 
+    if (m_interest_enabled) {
+        SynchronizeInterest(msg_length);
+        m_flatbuffers_manager.Reset();
+        m_broadcast = false;
+        return;
+    }
+
     // Get the length of message from each agent
     MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
                   m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
@@ -70,7 +84,9 @@ void SynMPICommunicator::Synchronize() {
     // if (m_rank == 0)
     //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
 
-    m_all_data.reserve(m_total_length);
+    m_all_data.resize(m_total_length);
+
+    RecordTraffic(size_t(msg_length) * (m_num_ranks - 1), m_total_length - msg_length);
 
     MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
                    m_all_data.data(), m_msg_lengths, m_msg_displs,
@@ -80,9 +96,81 @@ void SynMPICommunicator::Synchronize() {
     m_flatbuffers_manager.Reset();
 }
 
+bool SynMPICommunicator::EnableInterestManagement(bool val) {
+    m_interest_enabled = val;
+    m_num_peers = m_num_ranks - 1;
+    return true;
+}
+
+bool SynMPICommunicator::IsInterested(int i, int j) const {
+    const double* ri = &m_regions[i * REC_SIZE];
+    const double* rj = &m_regions[j * REC_SIZE];
+
+    int flags_i = (int)ri[REC_FLAGS];
+    int flags_j = (int)rj[REC_FLAGS];
+    if ((flags_i & FLAG_BROADCAST) || !(flags_i & FLAG_REGION) || !(flags_j & FLAG_REGION))
+        return true;
+
+    ChVector3d d(ri[REC_X] - rj[REC_X], ri[REC_Y] - rj[REC_Y], ri[REC_Z] - rj[REC_Z]);
+    double range = ri[REC_EXTENT] + rj[REC_EXTENT] + std::max(ri[REC_RADIUS], rj[REC_RADIUS]);
+    return d.Length2() <= range * range;
+}
+
+void SynMPICommunicator::SynchronizeInterest(int msg_length) {
+    // Exchange the (fixed size) region records of all ranks
+    double record[REC_SIZE];
+    record[REC_X] = m_region_center.x();
+    record[REC_Y] = m_region_center.y();
+    record[REC_Z] = m_region_center.z();
+    record[REC_EXTENT] = m_region_extent;
+    record[REC_RADIUS] = m_interest_radius;
+    record[REC_LENGTH] = msg_length;
+    record[REC_FLAGS] = (m_has_region ? FLAG_REGION : 0) | (m_broadcast ? FLAG_BROADCAST : 0);
+
+    m_regions.resize(m_num_ranks * REC_SIZE);
+    MPI_Allgather(record, REC_SIZE, MPI_DOUBLE, m_regions.data(), REC_SIZE, MPI_DOUBLE, MPI_COMM_WORLD);
+
+    // Set up the receive buffer with the data of the ranks that send to this rank.
+    // Buffers of all other ranks are left empty.
+    m_total_length = 0;
+    m_num_peers = 0;
+    for (int i = 0; i < m_num_ranks; i++) {
+        m_msg_displs[i] = m_total_length;
+        m_msg_lengths[i] = 0;
+        if (i != m_rank && IsInterested(i, m_rank)) {
+            m_msg_lengths[i] = (int)m_regions[i * REC_SIZE + REC_LENGTH];
+            m_total_length += m_msg_lengths[i];
+            m_num_peers++;
+        }
+    }
+    m_all_data.resize(m_total_length);
+
+    // Post all receives, then all sends, then wait for completion
+    m_requests.clear();
+    size_t num_sends = 0;
+    for (int i = 0; i < m_num_ranks; i++) {
+        if (m_msg_lengths[i] == 0)
+            continue;
+        m_requests.emplace_back();
+        MPI_Irecv(m_all_data.data() + m_msg_displs[i], m_msg_lengths[i], MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                  &m_requests.back());
+    }
+    for (int j = 0; j < m_num_ranks; j++) {
+        if (j == m_rank || msg_length == 0 || !IsInterested(m_rank, j))
+            continue;
+        m_requests.emplace_back();
+        MPI_Isend(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE, j, 0, MPI_COMM_WORLD,
+                  &m_requests.back());
+        num_sends++;
+    }
+    MPI_Waitall((int)m_requests.size(), m_requests.data(), MPI_STATUSES_IGNORE);
+
+    RecordTraffic(size_t(msg_length) * num_sends, m_total_length);
+}
+
 SynMessageList& SynMPICommunicator::GetMessages() {
     for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
+        if (i != m_rank && m_msg_lengths[i] > 0) {
             std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
                                                              m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
             m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
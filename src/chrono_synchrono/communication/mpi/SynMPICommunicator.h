@@ -83,11 +83,28 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual unsigned int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Enable or disable spatial interest management.
+    /// If enabled, each rank exchanges a small record describing its region of interest and the size of its
+    /// outgoing data; message buffers are then only exchanged (point-to-point) between ranks whose regions overlap.
+    ///
+    virtual bool EnableInterestManagement(bool val) override;
+
+    ///@brief Get the number of ranks this rank received data from at the last synchronization step
+    ///
+    int GetNumPeers() const { return m_num_peers; }
+
     // -----------------------------------------------------------------------------------------------
 
   private:
+    /// Exchange message buffers with the ranks in the region of interest only.
+    void SynchronizeInterest(int msg_length);
+
+    /// Check whether rank i sends its data to rank j, given the exchanged region records.
+    bool IsInterested(int i, int j) const;
+
     int m_rank;
     int m_num_ranks;
+    int m_num_peers;
 
     int m_total_length;
 
@@ -96,6 +113,9 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
 
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
+
+    std::vector<double> m_regions;        ///< region records of all ranks (interest management)
+    std::vector<MPI_Request> m_requests;  ///< pending point-to-point requests (interest management)
 };
 
 /// @} synchrono_communication
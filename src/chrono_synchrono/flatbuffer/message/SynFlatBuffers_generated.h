@@ -25,6 +25,9 @@ struct QuaternionBuilder;
 struct Pose;
 struct PoseBuilder;
 
+struct CompressedPoses;
+struct CompressedPosesBuilder;
+
 namespace Approach {
 
 struct State;
@@ -662,6 +665,77 @@ inline flatbuffers::Offset<Pose> CreatePose(flatbuffers::FlatBufferBuilder& _fbb
     return builder_.Finish();
 }
 
+struct CompressedPoses FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+    typedef CompressedPosesBuilder Builder;
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+        VT_SEQUENCE = 4,
+        VT_REFERENCE = 6,
+        VT_POS_RESOLUTION = 8,
+        VT_ROT_RESOLUTION = 10,
+        VT_DATA = 12
+    };
+    uint32_t sequence() const { return GetField<uint32_t>(VT_SEQUENCE, 0); }
+    uint32_t reference() const { return GetField<uint32_t>(VT_REFERENCE, 0); }
+    double pos_resolution() const { return GetField<double>(VT_POS_RESOLUTION, 0.0); }
+    double rot_resolution() const { return GetField<double>(VT_ROT_RESOLUTION, 0.0); }
+    const flatbuffers::Vector<uint8_t>* data() const { return GetPointer<const flatbuffers::Vector<uint8_t>*>(VT_DATA); }
+    bool Verify(flatbuffers::Verifier& verifier) const {
+        return VerifyTableStart(verifier) && VerifyField<uint32_t>(verifier, VT_SEQUENCE) &&
+               VerifyField<uint32_t>(verifier, VT_REFERENCE) && VerifyField<double>(verifier, VT_POS_RESOLUTION) &&
+               VerifyField<double>(verifier, VT_ROT_RESOLUTION) && VerifyOffset(verifier, VT_DATA) &&
+               verifier.VerifyVector(data()) && verifier.EndTable();
+    }
+};
+
+struct CompressedPosesBuilder {
+    typedef CompressedPoses Table;
+    flatbuffers::FlatBufferBuilder& fbb_;
+    flatbuffers::uoffset_t start_;
+    void add_sequence(uint32_t sequence) { fbb_.AddElement<uint32_t>(CompressedPoses::VT_SEQUENCE, sequence, 0); }
+    void add_reference(uint32_t reference) { fbb_.AddElement<uint32_t>(CompressedPoses::VT_REFERENCE, reference, 0); }
+    void add_pos_resolution(double pos_resolution) {
+        fbb_.AddElement<double>(CompressedPoses::VT_POS_RESOLUTION, pos_resolution, 0.0);
+    }
+    void add_rot_resolution(double rot_resolution) {
+        fbb_.AddElement<double>(CompressedPoses::VT_ROT_RESOLUTION, rot_resolution, 0.0);
+    }
+    void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+        fbb_.AddOffset(CompressedPoses::VT_DATA, data);
+    }
+    explicit CompressedPosesBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+    flatbuffers::Offset<CompressedPoses> Finish() {
+        const auto end = fbb_.EndTable(start_);
+        auto o = flatbuffers::Offset<CompressedPoses>(end);
+        return o;
+    }
+};
+
+inline flatbuffers::Offset<CompressedPoses> CreateCompressedPoses(
+    flatbuffers::FlatBufferBuilder& _fbb,
+    uint32_t sequence = 0,
+    uint32_t reference = 0,
+    double pos_resolution = 0.0,
+    double rot_resolution = 0.0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+    CompressedPosesBuilder builder_(_fbb);
+    builder_.add_rot_resolution(rot_resolution);
+    builder_.add_pos_resolution(pos_resolution);
+    builder_.add_data(data);
+    builder_.add_reference(reference);
+    builder_.add_sequence(sequence);
+    return builder_.Finish();
+}
+
+inline flatbuffers::Offset<CompressedPoses> CreateCompressedPosesDirect(flatbuffers::FlatBufferBuilder& _fbb,
+                                                                        uint32_t sequence = 0,
+                                                                        uint32_t reference = 0,
+                                                                        double pos_resolution = 0.0,
+                                                                        double rot_resolution = 0.0,
+                                                                        const std::vector<uint8_t>* data = nullptr) {
+    auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+    return SynFlatBuffers::CreateCompressedPoses(_fbb, sequence, reference, pos_resolution, rot_resolution, data__);
+}
+
 namespace Approach {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -873,17 +947,26 @@ namespace WheeledVehicle {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     typedef StateBuilder Builder;
-    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_TIME = 4, VT_CHASSIS = 6, VT_WHEELS = 8 };
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+        VT_TIME = 4,
+        VT_CHASSIS = 6,
+        VT_WHEELS = 8,
+        VT_COMPRESSED = 10
+    };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const SynFlatBuffers::Pose* chassis() const { return GetPointer<const SynFlatBuffers::Pose*>(VT_CHASSIS); }
     const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels() const {
         return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>*>(VT_WHEELS);
     }
+    const SynFlatBuffers::CompressedPoses* compressed() const {
+        return GetPointer<const SynFlatBuffers::CompressedPoses*>(VT_COMPRESSED);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
                VerifyOffset(verifier, VT_CHASSIS) && verifier.VerifyTable(chassis()) &&
                VerifyOffset(verifier, VT_WHEELS) && verifier.VerifyVector(wheels()) &&
-               verifier.VerifyVectorOfTables(wheels()) && verifier.EndTable();
+               verifier.VerifyVectorOfTables(wheels()) && VerifyOffset(verifier, VT_COMPRESSED) &&
+               verifier.VerifyTable(compressed()) && verifier.EndTable();
     }
 };
 
@@ -896,6 +979,9 @@ struct StateBuilder {
     void add_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels) {
         fbb_.AddOffset(State::VT_WHEELS, wheels);
     }
+    void add_compressed(flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed) {
+        fbb_.AddOffset(State::VT_COMPRESSED, compressed);
+    }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -908,9 +994,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0,
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed = 0) {
     StateBuilder builder_(_fbb);
     builder_.add_time(time);
+    builder_.add_compressed(compressed);
     builder_.add_wheels(wheels);
     builder_.add_chassis(chassis);
     return builder_.Finish();
@@ -920,9 +1008,10 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels = nullptr,
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed = 0) {
     auto wheels__ = wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*wheels) : 0;
-    return SynFlatBuffers::Agent::WheeledVehicle::CreateState(_fbb, time, chassis, wheels__);
+    return SynFlatBuffers::Agent::WheeledVehicle::CreateState(_fbb, time, chassis, wheels__, compressed);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1011,7 +1100,8 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
         VT_TRACK_SHOES = 8,
         VT_SPROCKETS = 10,
         VT_IDLERS = 12,
-        VT_ROAD_WHEELS = 14
+        VT_ROAD_WHEELS = 14,
+        VT_COMPRESSED = 16
     };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const SynFlatBuffers::Pose* chassis() const { return GetPointer<const SynFlatBuffers::Pose*>(VT_CHASSIS); }
@@ -1027,6 +1117,9 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* road_wheels() const {
         return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>*>(VT_ROAD_WHEELS);
     }
+    const SynFlatBuffers::CompressedPoses* compressed() const {
+        return GetPointer<const SynFlatBuffers::CompressedPoses*>(VT_COMPRESSED);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
                VerifyOffset(verifier, VT_CHASSIS) && verifier.VerifyTable(chassis()) &&
@@ -1036,7 +1129,7 @@ struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
                VerifyOffset(verifier, VT_IDLERS) && verifier.VerifyVector(idlers()) &&
                verifier.VerifyVectorOfTables(idlers()) && VerifyOffset(verifier, VT_ROAD_WHEELS) &&
                verifier.VerifyVector(road_wheels()) && verifier.VerifyVectorOfTables(road_wheels()) &&
-               verifier.EndTable();
+               VerifyOffset(verifier, VT_COMPRESSED) && verifier.VerifyTable(compressed()) && verifier.EndTable();
     }
 };
 
@@ -1060,6 +1153,9 @@ struct StateBuilder {
         flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels) {
         fbb_.AddOffset(State::VT_ROAD_WHEELS, road_wheels);
     }
+    void add_compressed(flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed) {
+        fbb_.AddOffset(State::VT_COMPRESSED, compressed);
+    }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -1075,9 +1171,11 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> track_shoes = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> sprockets = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> idlers = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> road_wheels = 0,
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed = 0) {
     StateBuilder builder_(_fbb);
     builder_.add_time(time);
+    builder_.add_compressed(compressed);
     builder_.add_road_wheels(road_wheels);
     builder_.add_idlers(idlers);
     builder_.add_sprockets(sprockets);
@@ -1093,13 +1191,14 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* track_shoes = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* sprockets = nullptr,
     const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* idlers = nullptr,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* road_wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* road_wheels = nullptr,
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed = 0) {
     auto track_shoes__ = track_shoes ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*track_shoes) : 0;
     auto sprockets__ = sprockets ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*sprockets) : 0;
     auto idlers__ = idlers ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*idlers) : 0;
     auto road_wheels__ = road_wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*road_wheels) : 0;
     return SynFlatBuffers::Agent::TrackedVehicle::CreateState(_fbb, time, chassis, track_shoes__, sprockets__, idlers__,
-                                                              road_wheels__);
+                                                              road_wheels__, compressed);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -18,6 +18,9 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono_synchrono/flatbuffer/message/SynMessageUtils.h"
 
 namespace chrono {
@@ -89,5 +92,143 @@ flatbuffers::Offset<SynFlatBuffers::Pose> SynPose::ToFlatBuffers(flatbuffers::Fl
     return fb_pose;
 }
 
+// ---------------------------------------------------------------------------------------------------------------
+
+SynCompressedPoses::SynCompressedPoses() : sequence(0), reference(0), pos_resolution(0), rot_resolution(0) {}
+
+SynCompressedPoses::SynCompressedPoses(const SynFlatBuffers::CompressedPoses* poses)
+    : sequence(poses->sequence()),
+      reference(poses->reference()),
+      pos_resolution(poses->pos_resolution()),
+      rot_resolution(poses->rot_resolution()) {
+    if (poses->data())
+        data.assign(poses->data()->begin(), poses->data()->end());
+}
+
+flatbuffers::Offset<SynFlatBuffers::CompressedPoses> SynCompressedPoses::ToFlatBuffers(
+    flatbuffers::FlatBufferBuilder& builder) const {
+    return SynFlatBuffers::CreateCompressedPosesDirect(builder, sequence, reference, pos_resolution, rot_resolution,
+                                                       &data);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+
+// Number of quantized values per pose (position and quaternion)
+static const size_t values_per_pose = 7;
+
+static void WriteVarint(std::vector<uint8_t>& data, uint64_t val) {
+    while (val >= 0x80) {
+        data.push_back(uint8_t(val) | 0x80);
+        val >>= 7;
+    }
+    data.push_back(uint8_t(val));
+}
+
+static bool ReadVarint(const std::vector<uint8_t>& data, size_t& pos, uint64_t& val) {
+    val = 0;
+    for (int shift = 0; shift < 64 && pos < data.size(); shift += 7) {
+        uint8_t byte = data[pos++];
+        val |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+// Map signed to unsigned integers so that values of small magnitude have short varint encodings
+static uint64_t ZigZag(int64_t val) {
+    return (uint64_t(val) << 1) ^ uint64_t(val >> 63);
+}
+
+static int64_t UnZigZag(uint64_t val) {
+    return int64_t(val >> 1) ^ -int64_t(val & 1);
+}
+
+SynPoseCodec::SynPoseCodec()
+    : m_pos_resolution(1e-4), m_rot_resolution(1e-5), m_keyframe_interval(10), m_sequence(0), m_keyframe(0) {}
+
+void SynPoseCodec::SetResolution(double pos_resolution, double rot_resolution) {
+    m_pos_resolution = pos_resolution;
+    m_rot_resolution = rot_resolution;
+    m_key_values.clear();
+}
+
+void SynPoseCodec::SetKeyframeInterval(unsigned int interval) {
+    m_keyframe_interval = std::max(interval, 1u);
+}
+
+void SynPoseCodec::Encode(const ChFrame<>& ref, const std::vector<SynPose>& poses, SynCompressedPoses& compressed) {
+    std::vector<int64_t> values(values_per_pose * poses.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        const auto& frame = poses[i].GetFrame();
+        ChVector3d pos = ref.TransformPointParentToLocal(frame.GetPos());
+        ChQuaternion<> rot = ref.GetRot().GetConjugate() * frame.GetRot();
+        if (rot.e0() < 0)
+            rot = -rot;
+
+        int64_t* v = &values[values_per_pose * i];
+        for (int k = 0; k < 3; k++)
+            v[k] = std::llround(pos[k] / m_pos_resolution);
+        for (int k = 0; k < 4; k++)
+            v[3 + k] = std::llround(rot[k] / m_rot_resolution);
+    }
+
+    bool keyframe = m_key_values.size() != values.size() || m_sequence - m_keyframe >= m_keyframe_interval;
+    if (keyframe) {
+        m_keyframe = m_sequence;
+        m_key_values = values;
+    }
+
+    compressed.sequence = m_sequence;
+    compressed.reference = m_keyframe;
+    compressed.pos_resolution = m_pos_resolution;
+    compressed.rot_resolution = m_rot_resolution;
+    compressed.data.clear();
+    compressed.data.reserve(values.size() + 1);
+
+    WriteVarint(compressed.data, poses.size());
+    for (size_t k = 0; k < values.size(); k++)
+        WriteVarint(compressed.data, ZigZag(keyframe ? values[k] : values[k] - m_key_values[k]));
+
+    m_sequence++;
+}
+
+bool SynPoseCodec::Decode(const ChFrame<>& ref, const SynCompressedPoses& compressed, std::vector<SynPose>& poses) {
+    size_t pos = 0;
+    uint64_t num_poses;
+    if (!ReadVarint(compressed.data, pos, num_poses) || num_poses > compressed.data.size())
+        return false;
+
+    std::vector<int64_t> values(values_per_pose * num_poses);
+    bool keyframe = compressed.IsKeyframe();
+    if (!keyframe && (m_key_values.size() != values.size() || m_keyframe != compressed.reference))
+        return false;
+
+    for (size_t k = 0; k < values.size(); k++) {
+        uint64_t val;
+        if (!ReadVarint(compressed.data, pos, val))
+            return false;
+        values[k] = UnZigZag(val) + (keyframe ? 0 : m_key_values[k]);
+    }
+
+    if (keyframe) {
+        m_keyframe = compressed.sequence;
+        m_key_values = values;
+    }
+
+    poses.resize(num_poses);
+    for (size_t i = 0; i < num_poses; i++) {
+        const int64_t* v = &values[values_per_pose * i];
+        ChVector3d pos_loc(v[0] * compressed.pos_resolution, v[1] * compressed.pos_resolution,
+                           v[2] * compressed.pos_resolution);
+        ChQuaternion<> rot_loc(v[3] * compressed.rot_resolution, v[4] * compressed.rot_resolution,
+                               v[5] * compressed.rot_resolution, v[6] * compressed.rot_resolution);
+        rot_loc.Normalize();
+        poses[i] = SynPose(ref.TransformPointLocalToParent(pos_loc), ref.GetRot() * rot_loc);
+    }
+
+    return true;
+}
+
 }  // namespace synchrono
 }  // namespace chrono
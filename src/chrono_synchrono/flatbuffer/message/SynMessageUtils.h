@@ -21,6 +21,9 @@
 #ifndef SYN_MESSAGE_UTILS_H
 #define SYN_MESSAGE_UTILS_H
 
+#include <cstdint>
+#include <vector>
+
 #include "chrono_synchrono/flatbuffer/message/SynFlatBuffers_generated.h"
 
 #include "chrono_vehicle/wheeled_vehicle/ChTire.h"
@@ -77,11 +80,75 @@ class SYN_API SynPose {
     flatbuffers::Offset<SynFlatBuffers::Pose> ToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const;
 
     ChFrameMoving<>& GetFrame() { return m_frame; }
+    const ChFrameMoving<>& GetFrame() const { return m_frame; }
 
   private:
     ChFrameMoving<> m_frame;
 };
 
+/// Compressed set of component poses, as generated by a SynPoseCodec
+class SYN_API SynCompressedPoses {
+  public:
+    SynCompressedPoses();
+
+    ///@brief Construct from a FlatBuffers compressed poses object
+    ///
+    ///@param poses the FlatBuffers compressed poses object
+    SynCompressedPoses(const SynFlatBuffers::CompressedPoses* poses);
+
+    ///@brief Convert this object to a flatbuffers compressed poses type
+    ///
+    ///@param builder the FlatBuffer builder used to construct messages
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> ToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const;
+
+    ///@brief Return true if no compressed data is present
+    bool IsEmpty() const { return data.empty(); }
+
+    ///@brief Return true if this is a keyframe (values not encoded relative to a previous state)
+    bool IsKeyframe() const { return sequence == reference; }
+
+    uint32_t sequence;          ///< sequence number of the encoded state
+    uint32_t reference;         ///< sequence number of the keyframe the values are encoded against
+    double pos_resolution;      ///< quantization step for positions
+    double rot_resolution;      ///< quantization step for quaternion components
+    std::vector<uint8_t> data;  ///< number of poses and quantized values, as zigzag varints
+};
+
+/// Encoder and decoder of the poses of the components of an agent (e.g. wheels, track shoes).
+/// Poses are expressed relative to a reference frame (typically the chassis, which is sent separately at full
+/// precision) and quantized to the specified resolution. Every keyframe_interval states, a keyframe with the quantized
+/// values is generated; all other states encode differences with respect to the last keyframe. Since these differences
+/// are small, they are stored as variable length integers, typically one or two bytes per value instead of 8.
+/// Encoding against the last keyframe (rather than the previous state) means that a receiver which misses some states
+/// only needs the latest keyframe to decode; states received before the first keyframe are discarded.
+/// A sender uses Encode and a receiver uses Decode, each with its own codec object.
+class SYN_API SynPoseCodec {
+  public:
+    SynPoseCodec();
+
+    ///@brief Set the quantization resolution for positions and quaternion components (default: 1e-4, 1e-5)
+    /// Changing the resolution forces a keyframe.
+    void SetResolution(double pos_resolution, double rot_resolution);
+
+    ///@brief Set the number of encoded states between keyframes (default: 10)
+    void SetKeyframeInterval(unsigned int interval);
+
+    ///@brief Encode the given poses relative to the specified reference frame
+    void Encode(const ChFrame<>& ref, const std::vector<SynPose>& poses, SynCompressedPoses& compressed);
+
+    ///@brief Decode poses relative to the specified reference frame
+    /// Returns false if the data cannot be decoded (corrupted data or keyframe not yet received).
+    bool Decode(const ChFrame<>& ref, const SynCompressedPoses& compressed, std::vector<SynPose>& poses);
+
+  private:
+    double m_pos_resolution;            ///< quantization step for positions
+    double m_rot_resolution;            ///< quantization step for quaternion components
+    unsigned int m_keyframe_interval;   ///< number of states between keyframes
+    uint32_t m_sequence;                ///< sequence number of the next encoded state
+    uint32_t m_keyframe;                ///< sequence number of the current keyframe
+    std::vector<int64_t> m_key_values;  ///< quantized values of the current keyframe
+};
+
 /// @} synchrono_flatbuffer
 
 }  // namespace synchrono
@@ -73,6 +73,8 @@ void SynTrackedVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     this->road_wheels.clear();
     for (auto road_wheel : (*state->road_wheels()))
         this->road_wheels.emplace_back(road_wheel);
+
+    this->compressed = state->compressed() ? SynCompressedPoses(state->compressed()) : SynCompressedPoses();
 }
 
 /// Generate FlatBuffers message from this message's state
@@ -99,6 +101,10 @@ FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffer
     for (const auto& road_wheel : this->road_wheels)
         road_wheels.push_back(road_wheel.ToFlatBuffers(builder));
 
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> compressed = 0;
+    if (!this->compressed.IsEmpty())
+        compressed = this->compressed.ToFlatBuffers(builder);
+
     auto vehicle_type = Agent::Type_TrackedVehicle_State;
     auto vehicle_state = TrackedVehicle::CreateStateDirect(builder,        //
                                                            this->time,     //
@@ -106,7 +112,8 @@ FlatBufferMessage SynTrackedVehicleStateMessage::ConvertToFlatBuffers(flatbuffer
                                                            &track_shoes,   //
                                                            &sprockets,     //
                                                            &idlers,        //
-                                                           &road_wheels);  //
+                                                           &road_wheels,   //
+                                                           compressed);    //
 
     auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state.Union());
     auto flatbuffer_message =
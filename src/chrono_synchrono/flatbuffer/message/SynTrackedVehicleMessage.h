@@ -73,6 +73,8 @@ class SynTrackedVehicleStateMessage : public SynMessage {
     std::vector<SynPose> sprockets;    ///< vector of vehicle's sprockets
     std::vector<SynPose> idlers;       ///< vector of vehicle's idlers
     std::vector<SynPose> road_wheels;  ///< vector of vehicle's road wheels
+
+    SynCompressedPoses compressed;  ///< compressed component poses (if not empty, replaces the pose vectors)
 };
 
 /// Description class that holds description information for a SynTrackedVehicle
@@ -54,6 +54,8 @@ void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     wheels.clear();
     for (auto wheel : (*state->wheels()))
         wheels.emplace_back(wheel);
+
+    compressed = state->compressed() ? SynCompressedPoses(state->compressed()) : SynCompressedPoses();
 }
 
 /// Generate FlatBuffers message from this message's state
@@ -65,9 +67,14 @@ FlatBufferMessage SynWheeledVehicleStateMessage::ConvertToFlatBuffers(flatbuffer
     for (const auto& wheel : this->wheels)
         flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
 
+    flatbuffers::Offset<SynFlatBuffers::CompressedPoses> flatbuffer_compressed = 0;
+    if (!this->compressed.IsEmpty())
+        flatbuffer_compressed = this->compressed.ToFlatBuffers(builder);
+
     auto vehicle_type = Agent::Type_WheeledVehicle_State;
-    auto vehicle_state =
-        WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels).Union();
+    auto vehicle_state = WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels,
+                                                           flatbuffer_compressed)
+                             .Union();
 
     auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state);
     auto flatbuffer_message =
@@ -64,6 +64,8 @@ class SYN_API SynWheeledVehicleStateMessage : public SynMessage {
 
     SynPose chassis;              ///< vehicle's chassis pose
     std::vector<SynPose> wheels;  ///< vector of vehicle's wheels
+
+    SynCompressedPoses compressed;  ///< compressed wheel poses (if not empty, replaces the wheel poses)
 };
 
 // ------------------------------------------------------------------------------------
@@ -19,6 +19,9 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <memory>
+#include <vector>
+
 #include "chrono/core/ChVector3.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +60,19 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Get the terrain height below each of the specified locations.
+    /// The output vector is resized to the number of locations. The default implementation calls GetHeight for each
+    /// location; derived classes may provide a more efficient implementation for multiple queries.
+    virtual void GetHeightBatch(const std::vector<ChVector3d>& loc, std::vector<double>& height) const;
+
+    /// Get all terrain characteristics below each of the specified locations.
+    /// The output vectors are resized to the number of locations. The default implementation calls GetProperties for
+    /// each location; derived classes may provide a more efficient implementation for multiple queries.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                    std::vector<double>& height,
+                                    std::vector<ChVector3d>& normal,
+                                    std::vector<float>& friction) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
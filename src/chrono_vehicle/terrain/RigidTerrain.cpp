@@ -51,6 +51,9 @@ RigidTerrain::RigidTerrain(ChSystem* system)
       m_num_patches(0),
       m_use_friction_functor(false),
       m_contact_callback(nullptr),
+      m_patch_grid_delta(1),
+      m_patch_grid_nx(0),
+      m_patch_grid_ny(0),
       m_collision_family(14),
       m_initialized(false) {}
 
@@ -62,6 +65,9 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
       m_num_patches(0),
       m_use_friction_functor(false),
       m_contact_callback(nullptr),
+      m_patch_grid_delta(1),
+      m_patch_grid_nx(0),
+      m_patch_grid_ny(0),
       m_collision_family(14),
       m_initialized(false) {
     // Open and parse the input file
@@ -173,6 +179,9 @@ void RigidTerrain::AddPatch(std::shared_ptr<Patch> patch,
     patch->m_friction = material->GetStaticFriction();
 
     m_patches.push_back(patch);
+
+    // A patch added after initialization is not in the patch grid until bound (see BindPatch)
+    m_patch_grid_start.clear();
 }
 
 void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
@@ -930,6 +939,7 @@ void RigidTerrain::Initialize() {
     for (auto& patch : m_patches) {
         InitializePatch(patch);
     }
+    CreatePatchGrid();
 
     m_initialized = true;
 
@@ -958,6 +968,8 @@ void RigidTerrain::BoxPatch::Initialize() {
 }
 
 void RigidTerrain::MeshPatch::Initialize() {
+    CreateQueryGrid();
+
     if (m_visualize) {
         m_body->AddVisualModel(chrono_types::make_shared<ChVisualModel>());
         auto trimesh_shape = chrono_types::make_shared<ChVisualShapeTriangleMesh>();
@@ -981,6 +993,7 @@ void RigidTerrain::BindPatch(std::shared_ptr<Patch> patch) {
 
     // Initialize the patch
     InitializePatch(patch);
+    CreatePatchGrid();
 
     // Bind the patch visual assets to the visual system (if present)
     if (m_system->GetVisualSystem())
@@ -1003,6 +1016,8 @@ void RigidTerrain::RemovePatch(std::shared_ptr<Patch> patch) {
         // Erase from the list of patches
         m_patches.erase(pos);
         m_num_patches--;
+        if (m_initialized)
+            CreatePatchGrid();
     }
 }
 
@@ -1075,27 +1090,144 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+void RigidTerrain::GetHeightBatch(const std::vector<ChVector3d>& loc, std::vector<double>& height) const {
+    height.resize(loc.size());
+
+    if (m_height_fun) {
+        for (size_t i = 0; i < loc.size(); i++)
+            height[i] = (*m_height_fun)(loc[i]);
+        return;
+    }
+
+    double h;
+    ChVector3d normal;
+    float friction;
+    for (size_t i = 0; i < loc.size(); i++)
+        height[i] = FindPoint(loc[i], h, normal, friction) ? h : 0.0;
+}
+
+void RigidTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                      std::vector<double>& height,
+                                      std::vector<ChVector3d>& normal,
+                                      std::vector<float>& friction) const {
+    height.resize(loc.size());
+    normal.resize(loc.size());
+    friction.resize(loc.size());
+    for (size_t i = 0; i < loc.size(); i++)
+        GetProperties(loc[i], height[i], normal[i], friction[i]);
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
     normal = ChWorldFrame::Vertical();
     friction = 0.8f;
 
-    for (auto patch : m_patches) {
+    auto check_patch = [&](const Patch& patch) {
         double pheight;
         ChVector3d pnormal;
-        bool phit = patch->FindPoint(loc, pheight, pnormal);
+        bool phit = patch.FindPoint(loc, pheight, pnormal);
         if (phit && pheight > height) {
             hit = true;
             height = pheight;
             normal = pnormal;
-            friction = patch->m_friction;
+            friction = patch.m_friction;
         }
+    };
+
+    if (m_patch_grid_start.empty()) {
+        for (const auto& patch : m_patches)
+            check_patch(*patch);
+        return hit;
+    }
+
+    // Check only the patches overlapping the grid cell of the query location
+    ChVector3d p = ChWorldFrame::ToISO(loc);
+    int i = (int)std::floor((p.x() - m_patch_grid_min.x()) / m_patch_grid_delta);
+    int j = (int)std::floor((p.y() - m_patch_grid_min.y()) / m_patch_grid_delta);
+    if (i >= 0 && i < m_patch_grid_nx && j >= 0 && j < m_patch_grid_ny) {
+        size_t c = (size_t)j * m_patch_grid_nx + i;
+        for (int k = m_patch_grid_start[c]; k < m_patch_grid_start[c + 1]; k++)
+            check_patch(*m_patches[m_patch_grid_list[k]]);
     }
+    for (auto k : m_patch_unbounded)
+        check_patch(*m_patches[k]);
 
     return hit;
 }
 
+void RigidTerrain::CreatePatchGrid() {
+    m_patch_grid_list.clear();
+    m_patch_unbounded.clear();
+    m_patch_grid_nx = 0;
+    m_patch_grid_ny = 0;
+    m_patch_grid_start.assign(1, 0);
+
+    // Horizontal bounds of the patches (slightly enlarged) and average patch extent
+    int num_patches = (int)m_patches.size();
+    std::vector<ChVector2d> pmin(num_patches);
+    std::vector<ChVector2d> pmax(num_patches);
+    std::vector<int> bounded;
+    ChVector2d vmin(+std::numeric_limits<double>::max());
+    ChVector2d vmax(-std::numeric_limits<double>::max());
+    double extent = 0;
+    for (int p = 0; p < num_patches; p++) {
+        if (!m_patches[p]->GetHorizontalBounds(pmin[p], pmax[p])) {
+            m_patch_unbounded.push_back(p);
+            continue;
+        }
+        pmin[p] -= ChVector2d(1e-6);
+        pmax[p] += ChVector2d(1e-6);
+        bounded.push_back(p);
+        vmin.x() = std::min(vmin.x(), pmin[p].x());
+        vmin.y() = std::min(vmin.y(), pmin[p].y());
+        vmax.x() = std::max(vmax.x(), pmax[p].x());
+        vmax.y() = std::max(vmax.y(), pmax[p].y());
+        extent += std::max(pmax[p].x() - pmin[p].x(), pmax[p].y() - pmin[p].y());
+    }
+    if (bounded.empty())
+        return;
+    extent /= bounded.size();
+
+    // Cell size of the order of a patch, with at most about 4 cells per patch
+    double lx = vmax.x() - vmin.x();
+    double ly = vmax.y() - vmin.y();
+    m_patch_grid_delta = std::max({extent, std::sqrt(lx * ly / (4.0 * bounded.size())), 1e-6});
+    m_patch_grid_min = vmin;
+    m_patch_grid_nx = (int)std::floor(lx / m_patch_grid_delta) + 1;
+    m_patch_grid_ny = (int)std::floor(ly / m_patch_grid_delta) + 1;
+
+    // Range of grid cells overlapped by each patch
+    auto cell_range = [this](const ChVector2d& min, const ChVector2d& max, int& i0, int& i1, int& j0, int& j1) {
+        i0 = std::max((int)std::floor((min.x() - m_patch_grid_min.x()) / m_patch_grid_delta), 0);
+        i1 = std::min((int)std::floor((max.x() - m_patch_grid_min.x()) / m_patch_grid_delta), m_patch_grid_nx - 1);
+        j0 = std::max((int)std::floor((min.y() - m_patch_grid_min.y()) / m_patch_grid_delta), 0);
+        j1 = std::min((int)std::floor((max.y() - m_patch_grid_min.y()) / m_patch_grid_delta), m_patch_grid_ny - 1);
+    };
+
+    // Bin the patches in the grid cells (count, then fill), preserving the patch order within each cell
+    m_patch_grid_start.assign((size_t)m_patch_grid_nx * m_patch_grid_ny + 1, 0);
+    for (auto p : bounded) {
+        int i0, i1, j0, j1;
+        cell_range(pmin[p], pmax[p], i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_patch_grid_start[(size_t)j * m_patch_grid_nx + i + 1]++;
+    }
+    for (size_t c = 1; c < m_patch_grid_start.size(); c++)
+        m_patch_grid_start[c] += m_patch_grid_start[c - 1];
+
+    std::vector<int> fill(m_patch_grid_start.begin(), m_patch_grid_start.end() - 1);
+    m_patch_grid_list.resize(m_patch_grid_start.back());
+    for (auto p : bounded) {
+        int i0, i1, j0, j1;
+        cell_range(pmin[p], pmax[p], i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_patch_grid_list[fill[(size_t)j * m_patch_grid_nx + i]++] = p;
+    }
+}
+
 bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
     // Ray definition (in global frame)
     ChVector3d A = loc;                        // start point
@@ -1112,7 +1244,144 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
     return std::abs(Cl.x()) <= m_hlength && std::abs(Cl.y()) <= m_hwidth;
 }
 
+bool RigidTerrain::BoxPatch::GetHorizontalBounds(ChVector2d& min, ChVector2d& max) const {
+    // Project the corners of the top surface (the patch body frame is at the center of the top surface)
+    min = ChVector2d(+std::numeric_limits<double>::max());
+    max = ChVector2d(-std::numeric_limits<double>::max());
+    for (double sx : {-1.0, +1.0}) {
+        for (double sy : {-1.0, +1.0}) {
+            ChVector3d c = ChWorldFrame::ToISO(
+                m_body->TransformPointLocalToParent(ChVector3d(sx * m_hlength, sy * m_hwidth, 0)));
+            min.x() = std::min(min.x(), c.x());
+            min.y() = std::min(min.y(), c.y());
+            max.x() = std::max(max.x(), c.x());
+            max.y() = std::max(max.y(), c.y());
+        }
+    }
+    return true;
+}
+
+void RigidTerrain::MeshPatch::CreateQueryGrid() {
+    const auto& vertices = m_trimesh->GetCoordsVertices();
+    const auto& faces = m_trimesh->GetIndicesVertexes();
+
+    m_grid_verts.resize(vertices.size());
+    m_grid_start.clear();
+    m_grid_tris.clear();
+    if (faces.empty())
+        return;
+
+    // Express the mesh vertices in the absolute ISO frame, where the vertical ray is along Z
+    for (size_t i = 0; i < vertices.size(); i++)
+        m_grid_verts[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+
+    // Bounding box of the horizontal projection and average triangle extent
+    ChVector2d vmin(+std::numeric_limits<double>::max());
+    ChVector2d vmax(-std::numeric_limits<double>::max());
+    double extent = 0;
+    for (const auto& f : faces) {
+        const auto& v0 = m_grid_verts[f[0]];
+        const auto& v1 = m_grid_verts[f[1]];
+        const auto& v2 = m_grid_verts[f[2]];
+        double tx = std::max({v0.x(), v1.x(), v2.x()}) - std::min({v0.x(), v1.x(), v2.x()});
+        double ty = std::max({v0.y(), v1.y(), v2.y()}) - std::min({v0.y(), v1.y(), v2.y()});
+        extent += std::max(tx, ty);
+    }
+    for (const auto& v : m_grid_verts) {
+        vmin.x() = std::min(vmin.x(), v.x());
+        vmin.y() = std::min(vmin.y(), v.y());
+        vmax.x() = std::max(vmax.x(), v.x());
+        vmax.y() = std::max(vmax.y(), v.y());
+    }
+    extent /= faces.size();
+
+    // Cell size of the order of a triangle, with at most about 4 cells per triangle
+    double lx = vmax.x() - vmin.x();
+    double ly = vmax.y() - vmin.y();
+    m_grid_delta = std::max({extent, std::sqrt(lx * ly / (4.0 * faces.size())), 1e-6});
+    m_grid_min = vmin;
+    m_grid_nx = (int)std::floor(lx / m_grid_delta) + 1;
+    m_grid_ny = (int)std::floor(ly / m_grid_delta) + 1;
+
+    // Range of grid cells overlapped by the projection of each triangle
+    auto cell_range = [this](const ChVector3d& v0, const ChVector3d& v1, const ChVector3d& v2, int& i0, int& i1,
+                             int& j0, int& j1) {
+        i0 = (int)std::floor((std::min({v0.x(), v1.x(), v2.x()}) - m_grid_min.x()) / m_grid_delta);
+        i1 = (int)std::floor((std::max({v0.x(), v1.x(), v2.x()}) - m_grid_min.x()) / m_grid_delta);
+        j0 = (int)std::floor((std::min({v0.y(), v1.y(), v2.y()}) - m_grid_min.y()) / m_grid_delta);
+        j1 = (int)std::floor((std::max({v0.y(), v1.y(), v2.y()}) - m_grid_min.y()) / m_grid_delta);
+        i0 = std::max(i0, 0);
+        j0 = std::max(j0, 0);
+        i1 = std::min(i1, m_grid_nx - 1);
+        j1 = std::min(j1, m_grid_ny - 1);
+    };
+
+    // Bin the triangles in the grid cells (count, then fill)
+    m_grid_start.assign((size_t)m_grid_nx * m_grid_ny + 1, 0);
+    for (const auto& f : faces) {
+        int i0, i1, j0, j1;
+        cell_range(m_grid_verts[f[0]], m_grid_verts[f[1]], m_grid_verts[f[2]], i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_grid_start[(size_t)j * m_grid_nx + i + 1]++;
+    }
+    for (size_t c = 1; c < m_grid_start.size(); c++)
+        m_grid_start[c] += m_grid_start[c - 1];
+
+    std::vector<int> fill(m_grid_start.begin(), m_grid_start.end() - 1);
+    m_grid_tris.resize(m_grid_start.back());
+    for (int t = 0; t < (int)faces.size(); t++) {
+        int i0, i1, j0, j1;
+        cell_range(m_grid_verts[faces[t][0]], m_grid_verts[faces[t][1]], m_grid_verts[faces[t][2]], i0, i1, j0, j1);
+        for (int j = j0; j <= j1; j++)
+            for (int i = i0; i <= i1; i++)
+                m_grid_tris[fill[(size_t)j * m_grid_nx + i]++] = t;
+    }
+}
+
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (!m_grid_start.empty()) {
+        // Same search range as the ray cast below: the first surface point below the query location
+        ChVector3d p = ChWorldFrame::ToISO(loc);
+        int i = (int)std::floor((p.x() - m_grid_min.x()) / m_grid_delta);
+        int j = (int)std::floor((p.y() - m_grid_min.y()) / m_grid_delta);
+        if (i < 0 || i >= m_grid_nx || j < 0 || j >= m_grid_ny)
+            return false;
+
+        const auto& faces = m_trimesh->GetIndicesVertexes();
+        const double eps = 1e-12;
+        double zmin = p.z() - (m_radius + 1000);
+        bool hit = false;
+        size_t c = (size_t)j * m_grid_nx + i;
+        for (int k = m_grid_start[c]; k < m_grid_start[c + 1]; k++) {
+            const auto& f = faces[m_grid_tris[k]];
+            const auto& v0 = m_grid_verts[f[0]];
+            const auto& v1 = m_grid_verts[f[1]];
+            const auto& v2 = m_grid_verts[f[2]];
+
+            // Barycentric coordinates of the projected query point (skip vertical triangles)
+            double det = (v1.x() - v0.x()) * (v2.y() - v0.y()) - (v2.x() - v0.x()) * (v1.y() - v0.y());
+            if (std::abs(det) < eps)
+                continue;
+            double b1 = ((p.x() - v0.x()) * (v2.y() - v0.y()) - (v2.x() - v0.x()) * (p.y() - v0.y())) / det;
+            double b2 = ((v1.x() - v0.x()) * (p.y() - v0.y()) - (p.x() - v0.x()) * (v1.y() - v0.y())) / det;
+            double b0 = 1 - b1 - b2;
+            if (b0 < -eps || b1 < -eps || b2 < -eps)
+                continue;
+
+            double z = b0 * v0.z() + b1 * v1.z() + b2 * v2.z();
+            if (z > p.z() || z < zmin || (hit && z <= height))
+                continue;
+
+            hit = true;
+            height = z;
+            ChVector3d n = Vcross(v1 - v0, v2 - v0);
+            normal = ChWorldFrame::FromISO(n.z() > 0 ? n.GetNormalized() : -n.GetNormalized());
+        }
+
+        return hit;
+    }
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -1124,6 +1393,15 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, C
     return result.hit;
 }
 
+bool RigidTerrain::MeshPatch::GetHorizontalBounds(ChVector2d& min, ChVector2d& max) const {
+    // Without a query grid, heights are obtained by ray casting and the patch is checked for all queries
+    if (m_grid_start.empty())
+        return false;
+    min = m_grid_min;
+    max = m_grid_min + ChVector2d(m_grid_nx, m_grid_ny) * m_grid_delta;
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
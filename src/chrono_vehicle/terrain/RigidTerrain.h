@@ -76,6 +76,7 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         Patch();
 
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const = 0;
+        virtual bool GetHorizontalBounds(ChVector2d& min, ChVector2d& max) const { return false; }
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) {}
         virtual void ExportMeshWavefront(const std::string& out_dir) {}
 
@@ -217,6 +218,17 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Get the terrain height below each of the specified locations.
+    /// Each location is processed as in GetHeight, without the overhead of a virtual call per query.
+    virtual void GetHeightBatch(const std::vector<ChVector3d>& loc, std::vector<double>& height) const override;
+
+    /// Get all terrain characteristics below each of the specified locations.
+    /// Each location is processed as in GetProperties, without the overhead of a virtual call per query.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                    std::vector<double>& height,
+                                    std::vector<ChVector3d>& normal,
+                                    std::vector<float>& friction) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -224,9 +236,11 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     void ExportMeshWavefront(const std::string& out_dir);
 
     /// Find the terrain height, normal, and coefficient of friction at the point below the specified location.
-    /// The point on the terrain surface is obtained through ray casting into the terrain contact model. The return
-    /// value is 'true' if the ray intersection succeeded and 'false' otherwise (in which case the output is set to
-    /// heigh=0, normal=world vertical, and friction=0.8).
+    /// The point on the terrain surface is obtained by intersecting a vertical ray with the patches whose horizontal
+    /// bounds contain the query location (analytically for box patches, through the patch query grid for mesh
+    /// patches). These patches are found through a uniform grid over the horizontal projection of all patches.
+    /// The return value is 'true' if the ray intersection succeeded and 'false' otherwise (in which case the output
+    /// is set to heigh=0, normal=world vertical, and friction=0.8).
     bool FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const;
 
     /// Set common collision family for patches. Default: 14.
@@ -243,17 +257,31 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         double m_hthickness;    ///< patch half-thickness
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        virtual bool GetHorizontalBounds(ChVector2d& min, ChVector2d& max) const override;
     };
 
     /// Patch represented as a mesh.
+    /// Height queries do not use the collision system. Instead, the mesh triangles are binned at initialization in a
+    /// uniform grid over their projection on the horizontal plane, and the vertical ray through the query point is
+    /// intersected only with the triangles in the grid cell containing that point. The grid assumes that the patch
+    /// does not move after initialization.
     struct CH_VEHICLE_API MeshPatch : public Patch {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+        std::vector<ChVector3d> m_grid_verts;                ///< mesh vertices, absolute, in ISO world frame
+        std::vector<int> m_grid_start;                       ///< start of the triangle list of each grid cell
+        std::vector<int> m_grid_tris;                        ///< triangle indices, sorted by grid cell
+        ChVector2d m_grid_min;                               ///< lower corner of the grid (ISO x-y)
+        double m_grid_delta;                                 ///< grid cell size
+        int m_grid_nx;                                       ///< number of grid cells in ISO x direction
+        int m_grid_ny;                                       ///< number of grid cells in ISO y direction
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        virtual bool GetHorizontalBounds(ChVector2d& min, ChVector2d& max) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
+        void CreateQueryGrid();
     };
 
     ChSystem* m_system;
@@ -267,6 +295,18 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                   std::shared_ptr<ChContactMaterial> material);
     void LoadPatch(const rapidjson::Value& a);
     void InitializePatch(std::shared_ptr<Patch> patch);
+    void CreatePatchGrid();
+
+    // Uniform grid over the horizontal projection (ISO x-y) of the patches, used to find the patches below a query
+    // location. The grid assumes that patches do not move after initialization. If the grid is not available (empty
+    // m_patch_grid_start), all patches are checked.
+    std::vector<int> m_patch_grid_start;  ///< start of the patch list of each grid cell
+    std::vector<int> m_patch_grid_list;   ///< patch indices, sorted by grid cell
+    std::vector<int> m_patch_unbounded;   ///< indices of patches without horizontal bounds (checked for all queries)
+    ChVector2d m_patch_grid_min;          ///< lower corner of the grid (ISO x-y)
+    double m_patch_grid_delta;            ///< grid cell size
+    int m_patch_grid_nx;                  ///< number of grid cells in ISO x direction
+    int m_patch_grid_ny;                  ///< number of grid cells in ISO y direction
 
     bool m_initialized;
     int m_collision_family;
@@ -0,0 +1,220 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Persistent storage for the modified nodes of an SCM deformable terrain grid.
+//
+// =============================================================================
+
+#ifndef SCM_NODE_GRID_H
+#define SCM_NODE_GRID_H
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChVector2.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Persistent storage for records of modified SCM grid nodes, indexed by their (possibly negative) grid coordinates.
+/// With a tile size larger than 1, node records are stored in square tiles of tile_size x tile_size nodes, allocated
+/// on demand. Only the tiles are hashed, so that locating a node requires a single hash-map lookup per tile (avoided
+/// altogether for consecutive accesses to the same tile). With a tile size of 1, each node record is stored
+/// individually in a hash map. In both cases, the addresses of node records remain valid as new nodes are recorded.
+/// Recorded nodes are visited (see ForEach) tile by tile, in the order in which the tiles were created, and in
+/// row-major order (x index varying fastest) within a tile. With a tile size of 1, this is the order in which the
+/// nodes were recorded.
+template <typename T>
+class SCMNodeGrid {
+  public:
+    SCMNodeGrid(int tile_size = 32) : m_tile_size(std::max(tile_size, 1)), m_num_nodes(0), m_last_tile(nullptr) {}
+
+    /// Set the tile size.
+    /// The tile size can only be changed while the grid is empty. Otherwise, the call is ignored (with a warning)
+    /// and the function returns false.
+    bool SetTileSize(int tile_size) {
+        if (m_num_nodes > 0) {
+            std::cerr << "WARNING: the SCM grid tile size cannot be changed after grid nodes were recorded (ignored)."
+                      << std::endl;
+            return false;
+        }
+        m_tile_size = std::max(tile_size, 1);
+        return true;
+    }
+
+    /// Get the tile size.
+    int GetTileSize() const { return m_tile_size; }
+
+    /// Return a pointer to the record of the specified node, or nullptr if the node was not yet recorded.
+    T* find(const ChVector2i& ij) {
+        if (m_tile_size == 1) {
+            auto n = m_nodes.find(ij);
+            return n == m_nodes.end() ? nullptr : &n->second;
+        }
+        ChVector2i tile_ij;
+        int k;
+        Locate(ij, tile_ij, k);
+        Tile* tile = GetTile(tile_ij, false);
+        if (!tile || !tile->active[k])
+            return nullptr;
+        return &tile->nodes[k];
+    }
+
+    /// Return a pointer to the record of the specified node, or nullptr if the node was not yet recorded.
+    /// Unlike the non-const version, this function does not use the cache of the last accessed tile and is therefore
+    /// safe to call concurrently.
+    const T* find(const ChVector2i& ij) const {
+        if (m_tile_size == 1) {
+            auto n = m_nodes.find(ij);
+            return n == m_nodes.end() ? nullptr : &n->second;
+        }
+        ChVector2i tile_ij;
+        int k;
+        Locate(ij, tile_ij, k);
+        auto t = m_tiles.find(tile_ij);
+        if (t == m_tiles.end() || !t->second->active[k])
+            return nullptr;
+        return &t->second->nodes[k];
+    }
+
+    /// Return a reference to the record of the specified node (which must exist).
+    T& at(const ChVector2i& ij) {
+        auto nr = find(ij);
+        assert(nr);
+        return *nr;
+    }
+
+    /// Return a reference to the record of the specified node (which must exist).
+    const T& at(const ChVector2i& ij) const {
+        auto nr = find(ij);
+        assert(nr);
+        return *nr;
+    }
+
+    /// Record the specified node (if not already present) and return a reference to its record.
+    T& insert(const ChVector2i& ij, const T& nr) {
+        if (m_tile_size == 1) {
+            auto n = m_nodes.insert(std::make_pair(ij, nr));
+            if (n.second) {
+                m_node_list.push_back(&*n.first);
+                m_num_nodes++;
+            }
+            return n.first->second;
+        }
+        ChVector2i tile_ij;
+        int k;
+        Locate(ij, tile_ij, k);
+        Tile* tile = GetTile(tile_ij, true);
+        if (!tile->active[k]) {
+            tile->nodes[k] = nr;
+            tile->active[k] = 1;
+            m_num_nodes++;
+        }
+        return tile->nodes[k];
+    }
+
+    /// Set the record of the specified node (inserting it if not already present).
+    void assign(const ChVector2i& ij, const T& nr) { insert(ij, nr) = nr; }
+
+    /// Return the number of recorded nodes.
+    size_t size() const { return m_num_nodes; }
+
+    /// Return the number of allocated tiles (equal to the number of recorded nodes if the tile size is 1).
+    size_t GetNumTiles() const { return m_tile_size == 1 ? m_num_nodes : m_tile_list.size(); }
+
+    /// Invoke the specified function, with arguments (const ChVector2i&, const T&), for each recorded node.
+    template <typename Func>
+    void ForEach(Func f) const {
+        if (m_tile_size == 1) {
+            for (const auto n : m_node_list)
+                f(n->first, n->second);
+            return;
+        }
+        for (const auto& tile : m_tile_list) {
+            for (int k = 0; k < m_tile_size * m_tile_size; k++) {
+                if (tile->active[k])
+                    f(ChVector2i(tile->ij.x() * m_tile_size + k % m_tile_size,
+                                 tile->ij.y() * m_tile_size + k / m_tile_size),
+                      tile->nodes[k]);
+            }
+        }
+    }
+
+    /// Calculate the coordinates of the tile containing the specified node and the index of the node within the tile.
+    void Locate(const ChVector2i& ij, ChVector2i& tile_ij, int& k) const {
+        // Floor division (grid indices can be negative)
+        int ti = ij.x() >= 0 ? ij.x() / m_tile_size : (ij.x() + 1) / m_tile_size - 1;
+        int tj = ij.y() >= 0 ? ij.y() / m_tile_size : (ij.y() + 1) / m_tile_size - 1;
+        tile_ij = ChVector2i(ti, tj);
+        k = (ij.x() - ti * m_tile_size) + m_tile_size * (ij.y() - tj * m_tile_size);
+    }
+
+  private:
+    struct CoordHash {
+        std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
+    };
+
+    struct Tile {
+        Tile(const ChVector2i& tile_ij, int num_nodes) : ij(tile_ij), nodes(num_nodes), active(num_nodes, 0) {}
+        ChVector2i ij;             // tile coordinates
+        std::vector<T> nodes;      // node records
+        std::vector<char> active;  // flags for recorded nodes
+    };
+
+    // Return the tile with given coordinates (optionally creating it), using a cache for the last accessed tile.
+    Tile* GetTile(const ChVector2i& tile_ij, bool create) {
+        if (m_last_tile && tile_ij == m_last_tile->ij)
+            return m_last_tile;
+
+        Tile* tile = nullptr;
+        auto t = m_tiles.find(tile_ij);
+        if (t != m_tiles.end()) {
+            tile = t->second;
+        } else if (create) {
+            m_tile_list.push_back(std::unique_ptr<Tile>(new Tile(tile_ij, m_tile_size * m_tile_size)));
+            tile = m_tile_list.back().get();
+            m_tiles.insert(std::make_pair(tile_ij, tile));
+        } else {
+            return nullptr;
+        }
+
+        m_last_tile = tile;
+        return tile;
+    }
+
+    int m_tile_size;
+    size_t m_num_nodes;
+
+    // Tiled storage (tile size larger than 1)
+    std::vector<std::unique_ptr<Tile>> m_tile_list;            // tiles, in order of creation
+    std::unordered_map<ChVector2i, Tile*, CoordHash> m_tiles;  // tiles, by tile coordinates
+    Tile* m_last_tile;                                         // last accessed tile
+
+    // Per-node storage (tile size of 1)
+    std::unordered_map<ChVector2i, T, CoordHash> m_nodes;        // node records, by node coordinates
+    std::vector<std::pair<const ChVector2i, T>*> m_node_list;  // node records, in order of insertion
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -140,6 +140,10 @@ void SCMTerrain::SetCosimulationMode(bool val) {
     m_loader->m_cosim_mode = val;
 }
 
+void SCMTerrain::SetGridTileSize(int tile_size) {
+    m_loader->m_grid_map.SetTileSize(tile_size);
+}
+
 // Set properties of the SCM soil model.
 void SCMTerrain::SetSoilParameters(
     double Bekker_Kphi,    // Kphi, frictional modulus in Bekker model
@@ -720,16 +724,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid_map.find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -813,10 +816,9 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid_map.find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -1031,10 +1033,6 @@ static const std::vector<ChVector2i> neighbors4{
     ChVector2i(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
-
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
@@ -1101,85 +1099,34 @@ void SCMLoader::ComputeInternalForces() {
 
     // Information of vertices with ray-cast hits
     struct HitRecord {
+        ChVector2i ij;               // grid node coordinates
         ChContactable* contactable;  // pointer to hit object
         ChVector3d abs_point;        // hit point, expressed in global frame
         int patch_id;                // index of associated patch id
     };
 
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2i, HitRecord, CoordHash> hits;
+    // List of vertices with ray-cast hits.
+    // Each thread collects its hits in a separate buffer; the buffers are then concatenated and duplicate hits (from
+    // overlapping moving patches) are discarded using the hit index cached in the node records.
+    std::vector<HitRecord> hits;
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
-
-    int nthreads = GetSystem()->GetNumThreadsChrono();
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2i ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
-
-            // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
-
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
-        }
-        m_num_ray_casts += num_ray_casts;
-    }
-
-#else
-
-    // Map-reduce approach (to eliminate critical section)
-
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
+    std::vector<std::vector<HitRecord>> t_hits(nthreads);
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
+        // Loop through all vertices in the patch range.
+        // With a static schedule, each thread processes a contiguous range of vertices, so that merging the per-thread
+        // hit lists in thread order reproduces the sequential order of hits, independent of the number of threads.
         int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
+#pragma omp parallel for schedule(static) num_threads(nthreads) reduction(+ : num_ray_casts)
         for (int k = 0; k < p.m_range.size(); k++) {
             int t_num = ChOMP::GetThreadNum();
             ChVector2i ij = p.m_range[k];
@@ -1205,9 +1152,9 @@ void SCMLoader::ComputeInternalForces() {
             num_ray_casts++;
 
             if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+                // Add to this thread's list of hits to process
+                HitRecord record = {ij, mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+                t_hits[t_num].push_back(record);
             }
         }
 
@@ -1215,25 +1162,30 @@ void SCMLoader::ComputeInternalForces() {
 
         m_num_ray_casts += num_ray_casts;
 
-        // Sequential insertion in global hits
+        // Sequential merge in global list of hits.
+        // With a static schedule, threads process contiguous chunks of the patch range, in thread order. The merged
+        // list therefore records hits in the order of the patch ranges, independently of the number of threads.
         for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
+            for (const auto& h : t_hits[t_num]) {
                 // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
+                auto nr = m_grid_map.find(h.ij);
+                if (!nr) {
+                    double z = GetInitHeight(h.ij);
+                    nr = &m_grid_map.insert(h.ij, NodeRecord(z, z, GetInitNormal(h.ij)));
                 }
-                ////hits.insert(h);
-            }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
+                // Ignore nodes already hit (from a different patch)
+                if (nr->hit_index != -1)
+                    continue;
+
+                nr->hit_index = (int)hits.size();
+                hits.push_back(h);
+            }
             t_hits[t_num].clear();
         }
         m_num_ray_hits = (int)hits.size();
     }
 
-#endif
-
     m_timer_ray_casting.stop();
 
     // --------------------
@@ -1256,13 +1208,13 @@ void SCMLoader::ComputeInternalForces() {
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
     m_num_contact_patches = 0;
     for (auto& h : hits) {
-        if (h.second.patch_id != -1)
+        if (h.patch_id != -1)
             continue;
 
-        ChVector2i ij = h.first;
+        ChVector2i ij = h.ij;
 
         // Make a new contact patch and add this hit node to it
-        h.second.patch_id = m_num_contact_patches++;
+        h.patch_id = m_num_contact_patches++;
         ContactPatchRecord patch;
         patch.nodes.push_back(ij);
         patch.points.push_back(ChVector2d(m_delta * ij.x(), m_delta * ij.y()));
@@ -1272,24 +1224,24 @@ void SCMLoader::ComputeInternalForces() {
         todo.push(ij);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
+            ChVector2i crt_ij = todo.front();  // Current hit node is first element in queue
+            todo.pop();                        // Remove first element from queue
 
-            ChVector2i crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            int crt_patch = h.patch_id;
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2i nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr_nr = m_grid_map.find(nbr_ij);
+                if (!nbr_nr || nbr_nr->hit_index == -1)
                     continue;
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                auto& nbr = hits[nbr_nr->hit_index];
+                if (nbr.patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr.patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2d(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
@@ -1333,14 +1285,17 @@ void SCMLoader::ComputeInternalForces() {
 
     // Process only hit nodes
     for (auto& h : hits) {
-        ChVector2d ij = h.first;
+        ChVector2d ij = h.ij;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid_map.at(h.ij);    // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector3d& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+        ChContactable* contactable = h.contactable;
+        const ChVector3d& hit_point_abs = h.abs_point;
+        int patch_id = h.patch_id;
+
+        // Clear the cached hit index (last use of this hit)
+        nr.hit_index = -1;
 
         auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
 
@@ -1534,10 +1489,11 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    auto nbr_nr = m_grid_map.find(nbr_ij);   //     neighbor node record
+                    if (!nbr_nr)                             //     if neighbor not yet recorded
+                        p_boundary.insert(nbr_ij);           //       set neighbor as boundary
+                    else if (nbr_nr->sigma <= 0)             //     if neighbor not touched
+                        p_boundary.insert(nbr_ij);           //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1546,17 +1502,18 @@ void SCMLoader::ComputeInternalForces() {
             double diff = m_flow_factor * tot_step_flow / p_boundary.size();
 
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
-            for (const auto& ij : p_boundary) {                                  // for each node in bndry
-                m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
-                    double z = GetInitHeight(ij);                                //     undeformed height
-                    const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
-                    m_modified_nodes.push_back(ij);                              //     mark as modified
-                }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
-                nr.erosion = true;                                               //   add to erosion domain
-                AddMaterialToNode(diff, nr);                                     //   add raise amount
+            for (const auto& ij : p_boundary) {                           // for each node in bndry
+                m_modified_nodes.push_back(ij);                           //   mark as modified
+                auto rec = m_grid_map.find(ij);                           //   node record
+                if (!rec) {                                               //   if not yet recorded
+                    double z = GetInitHeight(ij);                         //     undeformed height
+                    const ChVector3d& n = GetInitNormal(ij);              //     terrain normal
+                    rec = &m_grid_map.insert(ij, NodeRecord(z, z, n));    //     add new node record
+                    m_modified_nodes.push_back(ij);                       //     mark as modified
+                }                                                         //
+                auto& nr = *rec;                                          //   node record
+                nr.erosion = true;                                        //   add to erosion domain
+                AddMaterialToNode(diff, nr);                              //   add raise amount
             }
 
             // Accumulate boundary
@@ -1578,16 +1535,17 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    auto rec = m_grid_map.find(nbr_ij);                 //   neighbor node record
+                    if (!rec) {                                         //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid_map.assign(nbr_ij, nr);                  //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = *rec;                          //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1612,9 +1570,9 @@ void SCMLoader::ComputeInternalForces() {
                 for (int k = 0; k < 4; k++) {
                     ChVector2i nbr_ij = ij + neighbors4[k];
                     auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1782,14 +1740,13 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid_map.ForEach([&nodes](const ChVector2i& ij, const NodeRecord& nr) {  //
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            const auto& nr = m_grid_map.at(ij);
+            nodes.push_back(std::make_pair(ij, nr.level));
         }
     }
     return nodes;
@@ -1801,7 +1758,7 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
         // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        m_grid_map.assign(n.first, SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first)));
     }
 
     // Update visualization
@@ -23,6 +23,7 @@
 #include <string>
 #include <ostream>
 #include <unordered_map>
+#include <memory>
 
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/physics/ChBody.h"
@@ -37,6 +38,7 @@
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/ChTerrain.h"
 #include "chrono_vehicle/ChWorldFrame.h"
+#include "chrono_vehicle/terrain/SCMNodeGrid.h"
 
 namespace chrono {
 namespace vehicle {
@@ -223,6 +225,14 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// GetContactForceNode for rigid bodies and FEA nodes, respectively.
     void SetCosimulationMode(bool val);
 
+    /// Set the size of the tiles used to store the modified SCM grid nodes (default: 32).
+    /// Modified grid nodes are stored in square tiles of tile_size x tile_size nodes, allocated on demand the first
+    /// time one of their nodes is modified. Larger tiles reduce the cost of locating a node, at the price of
+    /// allocating memory for untouched nodes along the edges of the ruts. A tile size of 1 stores each modified node
+    /// individually in a hash map. The tile size cannot be changed once grid nodes were modified (such a call is
+    /// ignored, with a warning).
+    void SetGridTileSize(int tile_size);
+
     /// Initialize the terrain system (flat).
     /// This version creates a flat array of points.
     void Initialize(double sizeX,  ///< [in] terrain dimension in the X direction
@@ -409,6 +419,7 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         bool erosion;              // for bulldozing
         double massremainder;      // for bulldozing
         double step_plastic_flow;  // for bulldozing
+        int hit_index;             // index in list of ray-cast hits at current step (-1 if not hit)
 
         NodeRecord() : NodeRecord(0, 0, ChVector3d(0, 0, 1)) {}
         ~NodeRecord() {}
@@ -427,7 +438,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
               tau(0),
               erosion(false),
               massremainder(0),
-              step_plastic_flow(0) {}
+              step_plastic_flow(0),
+              hit_index(-1) {}
     };
 
     // Hash function for a pair of integer grid coordinates
@@ -437,6 +449,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Persistent storage for modified grid nodes
+    typedef SCMNodeGrid<NodeRecord> NodeGrid;
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -546,8 +561,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    NodeGrid m_grid_map;                       ///< modified grid nodes (persistent)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
@@ -19,6 +19,7 @@
 //
 // =============================================================================
 
+#include <array>
 #include <cmath>
 
 #include "chrono/physics/ChSystem.h"
@@ -272,25 +273,17 @@ bool ChTire::DiscTerrainCollision4pt(
     ChVector3d lateral = Vcross(normal, longitudinal);
 
     // Calculate four contact points in the contact patch
-    ChVector3d ptQ1 = wheel_bottom_location + dx * longitudinal;
-    double hQ1 = terrain.GetHeight(ptQ1 + voffset);
-    double ptQ1_height = ChWorldFrame::Height(ptQ1);
-    ptQ1 = ptQ1 - (ptQ1_height - hQ1) * ChWorldFrame::Vertical();
-
-    ChVector3d ptQ2 = wheel_bottom_location - dx * longitudinal;
-    double hQ2 = terrain.GetHeight(ptQ2 + voffset);
-    double ptQ2_height = ChWorldFrame::Height(ptQ2);
-    ptQ2 = ptQ2 - (ptQ2_height - hQ2) * ChWorldFrame::Vertical();
-
-    ChVector3d ptQ3 = wheel_bottom_location + dy * lateral;
-    double hQ3 = terrain.GetHeight(ptQ3 + voffset);
-    double ptQ3_height = ChWorldFrame::Height(ptQ3);
-    ptQ3 = ptQ3 - (ptQ3_height - hQ3) * ChWorldFrame::Vertical();
-
-    ChVector3d ptQ4 = wheel_bottom_location - dy * lateral;
-    double hQ4 = terrain.GetHeight(ptQ4 + voffset);
-    double ptQ4_height = ChWorldFrame::Height(ptQ4);
-    ptQ4 = ptQ4 - (ptQ4_height - hQ4) * ChWorldFrame::Vertical();
+    std::array<ChVector3d, 4> ptQ = {wheel_bottom_location + dx * longitudinal,
+                                     wheel_bottom_location - dx * longitudinal, wheel_bottom_location + dy * lateral,
+                                     wheel_bottom_location - dy * lateral};
+    for (auto& pt : ptQ) {
+        double pt_height = ChWorldFrame::Height(pt);
+        pt = pt - (pt_height - terrain.GetHeight(pt + voffset)) * ChWorldFrame::Vertical();
+    }
+    const ChVector3d& ptQ1 = ptQ[0];
+    const ChVector3d& ptQ2 = ptQ[1];
+    const ChVector3d& ptQ3 = ptQ[2];
+    const ChVector3d& ptQ4 = ptQ[3];
 
     // Calculate a smoothed road surface normal
     ChVector3d rQ2Q1 = ptQ1 - ptQ2;
@@ -354,11 +347,22 @@ bool ChTire::DiscTerrainCollisionEnvelope(
 
     const size_t n_div = 180;
     double x_step = 2.0 * disc_radius / n_div;
+
+    // Query the terrain height at all sample points along the disc at once (buffers reused across calls)
+    static thread_local std::vector<ChVector3d> locTest;
+    static thread_local std::vector<double> qTest;
+    locTest.resize(n_div - 1);
+    for (size_t i = 1; i < n_div; i++) {
+        double x = -disc_radius + x_step * double(i);
+        locTest[i - 1] = disc_center + x * longitudinal + voffset;
+    }
+    terrain.GetHeightBatch(locTest, qTest);
+
     double A = 0;  // overlapping area of tire disc and road surface contour
     for (size_t i = 1; i < n_div; i++) {
         double x = -disc_radius + x_step * double(i);
         ChVector3d pTest = disc_center + x * longitudinal;
-        double q = terrain.GetHeight(pTest + voffset);
+        double q = qTest[i - 1];
         double a = ChWorldFrame::Height(pTest) - sqrt(disc_radius * disc_radius - x * x);
         if (q > a) {
             A += q - a;
@@ -14,6 +14,10 @@
 //
 // Benchmark test for ANCF shell elements.
 //
+// The MINRES benchmarks on the largest mesh are also run with different numbers
+// of threads, reporting the time spent in the (colored, multithreaded) evaluation
+// of element internal forces.
+//
 // Note that the MKL Pardiso and Mumps solvers are set to lock the sparsity
 // pattern, but not to use the sparsity pattern learner.
 //
@@ -57,10 +61,15 @@ class ANCFshell : public utils::ChBenchmarkTest {
 
     void SimulateVis();
 
+    /// Return the cumulative time (in ms) spent in evaluating element internal forces since the last reset.
+    double GetTimeInternalForces() const { return m_mesh->GetTimeInternalForces() * 1e3; }
+    void ResetTimeInternalForces() { m_mesh->ResetTimers(); }
+
   protected:
-    ANCFshell(SolverType solver_type);
+    ANCFshell(SolverType solver_type, int num_threads = 4);
 
     ChSystemSMC* m_system;
+    std::shared_ptr<ChMesh> m_mesh;
 };
 
 template <int N>
@@ -69,6 +78,12 @@ class ANCFshell_MINRES : public ANCFshell<N> {
     ANCFshell_MINRES() : ANCFshell<N>(SolverType::MINRES) {}
 };
 
+template <int N, int NTHREADS>
+class ANCFshell_MINRES_MT : public ANCFshell<N> {
+  public:
+    ANCFshell_MINRES_MT() : ANCFshell<N>(SolverType::MINRES, NTHREADS) {}
+};
+
 template <int N>
 class ANCFshell_SparseQR : public ANCFshell<N> {
   public:
@@ -88,10 +103,10 @@ class ANCFshell_MUMPS : public ANCFshell<N> {
 };
 
 template <int N>
-ANCFshell<N>::ANCFshell(SolverType solver_type) {
+ANCFshell<N>::ANCFshell(SolverType solver_type, int num_threads) {
     m_system = new ChSystemSMC();
     m_system->SetGravitationalAcceleration(ChVector3d(0, -9.8, 0));
-    m_system->SetNumThreads(4);
+    m_system->SetNumThreads(num_threads);
 
     // Set solver parameters
 #ifndef CHRONO_PARDISO_MKL
@@ -168,6 +183,7 @@ ANCFshell<N>::ANCFshell(SolverType solver_type) {
     // Create mesh nodes and elements
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
+    m_mesh = mesh;
 
     auto vis_surf = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
     vis_surf->SetFEMdataType(ChVisualShapeFEA::DataType::SURFACE);
@@ -250,6 +266,25 @@ CH_BM_SIMULATION_LOOP(ANCFshell16_SparseQR, ANCFshell_SparseQR<16>, NUM_SKIP_STE
 CH_BM_SIMULATION_LOOP(ANCFshell32_SparseQR, ANCFshell_SparseQR<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell64_SparseQR, ANCFshell_SparseQR<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+// Thread scaling of the element internal force evaluation
+#define CH_BM_ANCFSHELL_MT(TEST_NAME, N, NTHREADS)                                                   \
+    using TEST_NAME = utils::ChBenchmarkFixture<ANCFshell_MINRES_MT<N, NTHREADS>, NUM_SKIP_STEPS>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                            \
+        m_test->ResetTimeInternalForces();                                                           \
+        while (st.KeepRunning()) {                                                                   \
+            m_test->Simulate(NUM_SIM_STEPS);                                                         \
+        }                                                                                            \
+        Report(st);                                                                                  \
+        st.counters["FEA_InternalFrc"] = m_test->GetTimeInternalForces() / st.iterations();          \
+        st.counters["Threads"] = NTHREADS;                                                           \
+    }                                                                                                \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(10);
+
+CH_BM_ANCFSHELL_MT(ANCFshell64_MINRES_1thread, 64, 1);
+CH_BM_ANCFSHELL_MT(ANCFshell64_MINRES_2threads, 64, 2);
+CH_BM_ANCFSHELL_MT(ANCFshell64_MINRES_4threads, 64, 4);
+CH_BM_ANCFSHELL_MT(ANCFshell64_MINRES_8threads, 64, 8);
+
 #ifdef CHRONO_PARDISO_MKL
 CH_BM_SIMULATION_LOOP(ANCFshell08_MKL, ANCFshell_MKL<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(ANCFshell16_MKL, ANCFshell_MKL<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
@@ -17,6 +17,12 @@
 // Note that the MKL Pardiso and Mumps solvers are set to lock the sparsity
 // pattern, but not to use the sparsity pattern learner.
 //
+// The ADMM tests use the NSC (complementarity) contact formulation. Caching of
+// the KKT factorizations for different ADMM steps and multithreading (e.g.,
+// projection on the friction cones) are benchmarked separately against the
+// baseline ADMM configuration. APGD is not included since it cannot account for
+// the stiffness blocks of the FEA meshes.
+//
 // =============================================================================
 
 #include "chrono/ChConfig.h"
@@ -24,8 +30,10 @@
 
 #include "chrono/assets/ChTexture.h"
 #include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/solver/ChSolverADMM.h"
 
 #include "chrono/fea/ChBuilderBeam.h"
 #include "chrono/fea/ChContactSurfaceMesh.h"
@@ -49,7 +57,7 @@
 using namespace chrono;
 using namespace chrono::fea;
 
-enum class SolverType { MINRES, MKL, MUMPS };
+enum class SolverType { MINRES, MKL, MUMPS, ADMM, ADMM_CACHED, ADMM_MT };
 
 class FEAcontactTest : public utils::ChBenchmarkTest {
   public:
@@ -64,11 +72,11 @@ class FEAcontactTest : public utils::ChBenchmarkTest {
     FEAcontactTest(SolverType solver_type);
 
   private:
-    void CreateFloor(std::shared_ptr<ChContactMaterialSMC> cmat);
-    void CreateBeams(std::shared_ptr<ChContactMaterialSMC> cmat);
-    void CreateCables(std::shared_ptr<ChContactMaterialSMC> cmat);
+    void CreateFloor(std::shared_ptr<ChContactMaterial> cmat);
+    void CreateBeams(std::shared_ptr<ChContactMaterial> cmat);
+    void CreateCables(std::shared_ptr<ChContactMaterial> cmat);
 
-    ChSystemSMC* m_system;
+    ChSystem* m_system;
 };
 
 class FEAcontactTest_MINRES : public FEAcontactTest {
@@ -86,8 +94,28 @@ class FEAcontactTest_MUMPS : public FEAcontactTest {
     FEAcontactTest_MUMPS() : FEAcontactTest(SolverType::MUMPS) {}
 };
 
+class FEAcontactTest_ADMM : public FEAcontactTest {
+  public:
+    FEAcontactTest_ADMM() : FEAcontactTest(SolverType::ADMM) {}
+};
+
+class FEAcontactTest_ADMM_cached : public FEAcontactTest {
+  public:
+    FEAcontactTest_ADMM_cached() : FEAcontactTest(SolverType::ADMM_CACHED) {}
+};
+
+class FEAcontactTest_ADMM_mt : public FEAcontactTest {
+  public:
+    FEAcontactTest_ADMM_mt() : FEAcontactTest(SolverType::ADMM_MT) {}
+};
+
 FEAcontactTest::FEAcontactTest(SolverType solver_type) {
-    m_system = new ChSystemSMC();
+    bool nsc = (solver_type == SolverType::ADMM || solver_type == SolverType::ADMM_CACHED ||
+                solver_type == SolverType::ADMM_MT);
+    if (nsc)
+        m_system = new ChSystemNSC();
+    else
+        m_system = new ChSystemSMC();
     m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
 
     // Set solver parameters
@@ -116,6 +144,7 @@ FEAcontactTest::FEAcontactTest(SolverType solver_type) {
             solver->SetTolerance(1e-12);
 
             m_system->SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+            break;
         }
         case SolverType::MKL: {
 #ifdef CHRONO_PARDISO_MKL
@@ -137,30 +166,61 @@ FEAcontactTest::FEAcontactTest(SolverType solver_type) {
 #endif
             break;
         }
+        case SolverType::ADMM:
+        case SolverType::ADMM_CACHED:
+        case SolverType::ADMM_MT: {
+#ifdef CHRONO_PARDISO_MKL
+            auto ls_solver = chrono_types::make_shared<ChSolverPardisoMKL>();
+#else
+            auto ls_solver = chrono_types::make_shared<ChSolverSparseLU>();
+#endif
+            auto solver = chrono_types::make_shared<ChSolverADMM>(ls_solver);
+            solver->EnableWarmStart(true);
+            solver->SetMaxIterations(60);
+            solver->SetToleranceDual(1e-4);
+            solver->SetTolerancePrimal(1e-4);
+            solver->SetRho(1);
+            solver->SetStepAdjustPolicy(ChSolverADMM::AdmmStepType::BALANCED_UNSCALED);
+            if (solver_type == SolverType::ADMM_CACHED)
+                solver->SetFactorizationCacheSize(4);
+            if (solver_type == SolverType::ADMM_MT)
+                m_system->SetNumThreads(4);
+            m_system->SetSolver(solver);
+            break;
+        }
     }
 
     ChCollisionInfo::SetDefaultEffectiveCurvatureRadius(1);
     ChCollisionModel::SetDefaultSuggestedMargin(0.006);
 
-    auto cmat = chrono_types::make_shared<ChContactMaterialSMC>();
-    cmat->SetYoungModulus(6e4);
-    cmat->SetFriction(0.3f);
-    cmat->SetRestitution(0.2f);
-    cmat->SetAdhesion(0);
+    std::shared_ptr<ChContactMaterial> cmat;
+    if (nsc) {
+        ChCollisionModel::SetDefaultSuggestedEnvelope(0.0025);
+        auto cmat_nsc = chrono_types::make_shared<ChContactMaterialNSC>();
+        cmat_nsc->SetFriction(0.3f);
+        cmat = cmat_nsc;
+    } else {
+        auto cmat_smc = chrono_types::make_shared<ChContactMaterialSMC>();
+        cmat_smc->SetYoungModulus(6e4);
+        cmat_smc->SetFriction(0.3f);
+        cmat_smc->SetRestitution(0.2f);
+        cmat_smc->SetAdhesion(0);
+        cmat = cmat_smc;
+    }
 
     CreateFloor(cmat);
     CreateBeams(cmat);
     CreateCables(cmat);
 }
 
-void FEAcontactTest::CreateFloor(std::shared_ptr<ChContactMaterialSMC> cmat) {
+void FEAcontactTest::CreateFloor(std::shared_ptr<ChContactMaterial> cmat) {
     auto mfloor = chrono_types::make_shared<ChBodyEasyBox>(2, 0.1, 2, 2700, true, true, cmat);
     mfloor->SetFixed(true);
     mfloor->GetVisualShape(0)->SetTexture(GetChronoDataFile("textures/concrete.jpg"));
     m_system->Add(mfloor);
 }
 
-void FEAcontactTest::CreateBeams(std::shared_ptr<ChContactMaterialSMC> cmat) {
+void FEAcontactTest::CreateBeams(std::shared_ptr<ChContactMaterial> cmat) {
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
@@ -193,7 +253,7 @@ void FEAcontactTest::CreateBeams(std::shared_ptr<ChContactMaterialSMC> cmat) {
     mesh->AddVisualShapeFEA(vis_speed);
 }
 
-void FEAcontactTest::CreateCables(std::shared_ptr<ChContactMaterialSMC> cmat) {
+void FEAcontactTest::CreateCables(std::shared_ptr<ChContactMaterial> cmat) {
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
@@ -261,6 +321,10 @@ CH_BM_SIMULATION_ONCE(FEAcontact_MKL, FEAcontactTest_MKL, NUM_SKIP_STEPS, NUM_SI
 CH_BM_SIMULATION_ONCE(FEAcontact_MUMPS, FEAcontactTest_MUMPS, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 #endif
 
+CH_BM_SIMULATION_ONCE(FEAcontact_ADMM, FEAcontactTest_ADMM, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_ONCE(FEAcontact_ADMM_cached, FEAcontactTest_ADMM_cached, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_ONCE(FEAcontact_ADMM_mt, FEAcontactTest_ADMM_mt, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
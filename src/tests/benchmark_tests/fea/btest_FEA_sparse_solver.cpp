@@ -103,6 +103,8 @@ class SystemFixture : public ::benchmark::Fixture {
         auto solver = std::static_pointer_cast<ChDirectSolverLS>(m_system->GetSolver());
         st.counters["LS_Setup_assembly"] = solver->GetTimeSetup_Assembly() * 1e3 / num_it;
         st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
+        st.counters["LS_Setup_symbolic"] = solver->GetTimeSetup_SolverCallSymbolic() * 1e3 / num_it;
+        st.counters["LS_Setup_numeric"] = solver->GetTimeSetup_SolverCallNumeric() * 1e3 / num_it;
         st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
         st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
     }
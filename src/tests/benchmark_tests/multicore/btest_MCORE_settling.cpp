@@ -12,7 +12,10 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// Chrono::Multicore benchmark program using SMC method for frictional contact.
+// Chrono::Multicore benchmark program for the settling of granular material,
+// using the SMC method for frictional contact. For the NSC method, the settling
+// test is run with and without warm-starting of the contact impulses, and the
+// average number of solver iterations per step is reported.
 //
 // The global reference frame has Z up.
 // =============================================================================
@@ -151,6 +154,106 @@ void SettlingSMC::SimulateVis() {
 
 // =============================================================================
 
+template <bool WARM_START>
+class SettlingNSC : public utils::ChBenchmarkTest {
+  public:
+    SettlingNSC();
+    ~SettlingNSC() { delete m_system; }
+
+    void SetNumthreads(int nthreads) { m_system->SetNumThreads(nthreads); }
+    unsigned int GetNumParticles() const { return m_num_particles; }
+
+    void ResetIterations() { m_num_iterations = 0; }
+    unsigned int GetNumIterations() const { return m_num_iterations; }
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_num_iterations += m_system->data_manager->measures.solver.total_iteration;
+    }
+
+  private:
+    ChSystemMulticoreNSC* m_system;
+    double m_step;
+    unsigned int m_num_particles;
+    unsigned int m_num_iterations;
+};
+
+template <bool WARM_START>
+SettlingNSC<WARM_START>::SettlingNSC() : m_system(new ChSystemMulticoreNSC), m_step(1e-3), m_num_iterations(0) {
+    // Simulation parameters
+    double gravity = 9.81;
+
+    uint max_iteration = 100;
+    real tolerance = 1e-3;
+
+    // Set gravitational acceleration
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -gravity));
+
+    // Set solver parameters
+    m_system->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    m_system->GetSettings()->solver.max_iteration_normal = 0;
+    m_system->GetSettings()->solver.max_iteration_sliding = max_iteration;
+    m_system->GetSettings()->solver.max_iteration_spinning = 0;
+    m_system->GetSettings()->solver.max_iteration_bilateral = max_iteration;
+    m_system->GetSettings()->solver.tolerance = tolerance;
+    m_system->GetSettings()->solver.alpha = 0;
+    m_system->GetSettings()->solver.contact_recovery_speed = 10;
+    m_system->GetSettings()->solver.warm_start = WARM_START;
+    m_system->ChangeSolverType(SolverType::APGD);
+
+    m_system->GetSettings()->collision.collision_envelope = 0.01 * 0.02;
+    m_system->GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+
+    // Create a common material
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    // Container half-dimensions
+    ChVector3d hdim(2, 2, 0.5);
+
+    // Create a bin consisting of five boxes attached to the ground.
+    auto bin = chrono_types::make_shared<ChBody>();
+    bin->SetMass(1);
+    bin->SetPos(ChVector3d(0, 0, 0));
+    bin->EnableCollision(true);
+    bin->SetFixed(true);
+
+    utils::AddBoxContainer(bin, mat,                                      //
+                           ChFrame<>(ChVector3d(0, 0, hdim.z()), QUNIT),  //
+                           hdim * 2, 0.2,                                 //
+                           ChVector3i(2, 2, -1));
+
+    m_system->AddBody(bin);
+
+    // Create granular material in layers
+    double rho = 2000;
+    double radius = 0.02;
+    int num_layers = 8;
+
+    // Create a particle generator and a mixture entirely made out of spheres
+    double r = 1.01 * radius;
+    utils::ChPDSampler<double> sampler(2 * r);
+    utils::ChGenerator gen(m_system);
+    std::shared_ptr<utils::ChMixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->SetDefaultMaterial(mat);
+    m1->SetDefaultDensity(rho);
+    m1->SetDefaultSize(radius);
+
+    // Create particles in layers until reaching the desired number of particles
+    ChVector3d range(hdim.x() - r, hdim.y() - r, 0);
+    ChVector3d center(0, 0, 2 * r);
+    for (int il = 0; il < num_layers; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+
+    m_num_particles = gen.GetTotalNumBodies();
+}
+
+// =============================================================================
+
 #define NUM_SKIP_STEPS 500  // number of steps for hot start
 #define NUM_SIM_STEPS 500  // number of simulation steps for benchmarking
 
@@ -174,6 +277,30 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+// Settling with the NSC method, without and with warm-starting of contact impulses.
+// Besides timing information, report the average number of solver iterations per step.
+#define SETTLING_NSC_BENCHMARK(TEST_NAME, WARM_START)                                               \
+    using TEST_NAME = chrono::utils::ChBenchmarkFixture<SettlingNSC<WARM_START>, 0>;                \
+    BENCHMARK_DEFINE_F(TEST_NAME, Settle)(benchmark::State & st) {                                  \
+        Reset(NUM_SKIP_STEPS);                                                                      \
+        m_test->SetNumthreads((int)st.range(0));                                                    \
+        m_test->ResetIterations();                                                                  \
+        while (st.KeepRunning()) {                                                                  \
+            m_test->Simulate(NUM_SIM_STEPS);                                                        \
+        }                                                                                           \
+        Report(st);                                                                                 \
+        st.counters["Solver_Iterations"] = (double)m_test->GetNumIterations() / NUM_SIM_STEPS;      \
+    }                                                                                               \
+    BENCHMARK_REGISTER_F(TEST_NAME, Settle)                                                         \
+        ->Unit(benchmark::kMillisecond)                                                             \
+        ->Iterations(1)                                                                             \
+        ->Repetitions(1)                                                                            \
+        ->UseRealTime()                                                                             \
+        ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
+SETTLING_NSC_BENCHMARK(SettlingNSC_Cold, false)
+SETTLING_NSC_BENCHMARK(SettlingNSC_Warm, true)
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
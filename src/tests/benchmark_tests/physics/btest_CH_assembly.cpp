@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for multithreaded processing of assembly items.
+// A large number of pendulum chains (bodies connected through revolute joints)
+// is simulated with a varying number of threads used for the assembly update
+// and state gather/scatter operations.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <int NTHREADS>
+class AssemblyTest : public utils::ChBenchmarkTest {
+  public:
+    AssemblyTest();
+    ~AssemblyTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+template <int NTHREADS>
+AssemblyTest<NTHREADS>::AssemblyTest() : m_step(1e-3) {
+    int num_chains = 100;
+    int num_links = 50;
+    double length = 0.25;
+
+    // Create system and enable multithreaded processing of assembly items
+    m_system = new ChSystemNSC;
+    m_system->SetGravitationalAcceleration(ChVector3d(0, -1, 0));
+    m_system->SetNumThreads(NTHREADS, 1, 1);
+    m_system->EnableAssemblyMultithreading(true);
+
+    // Set solver parameters
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(20);
+    m_system->SetSolver(solver);
+
+    // Create ground
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    m_system->AddBody(ground);
+
+    // Create pendulum chains
+    for (int ic = 0; ic < num_chains; ic++) {
+        std::shared_ptr<ChBody> prev = ground;
+        for (int ib = 0; ib < num_links; ib++) {
+            auto pend = chrono_types::make_shared<ChBody>();
+            pend->SetPos(ChVector3d((ib + 0.5) * length, 0, ic * 0.5));
+            pend->SetMass(1.0);
+            pend->SetInertiaXX(ChVector3d(0.01, 0.01, 0.01));
+            m_system->AddBody(pend);
+
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(pend, prev, ChFrame<>(ChVector3d(ib * length, 0, ic * 0.5)));
+            m_system->AddLink(rev);
+
+            prev = pend;
+        }
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 200  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for each benchmark
+
+CH_BM_SIMULATION_LOOP(Assembly_1thread, AssemblyTest<1>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Assembly_2threads, AssemblyTest<2>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Assembly_4threads, AssemblyTest<4>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Assembly_8threads, AssemblyTest<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
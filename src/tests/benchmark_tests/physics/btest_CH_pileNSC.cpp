@@ -0,0 +1,152 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the multithreaded (graph-colored) PSOR solver.
+// A pile of spheres settles in a box under gravity. The PSOR solver is run for a
+// fixed number of iterations with a varying number of threads. Besides timing,
+// each benchmark reports the average constraint violation at the end of the
+// solver iterations (to compare convergence of the sequential and colored sweeps)
+// and the average number of colors.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChRandom.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <int NTHREADS>
+class PileTestNSC : public utils::ChBenchmarkTest {
+  public:
+    PileTestNSC();
+    ~PileTestNSC() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override;
+
+    void ResetStats();
+    double GetAverageViolation() const { return m_num_steps ? m_violation / m_num_steps : 0; }
+    double GetAverageColors() const { return m_num_steps ? m_colors / m_num_steps : 0; }
+
+  private:
+    ChSystemNSC* m_system;
+    std::shared_ptr<ChSolverPSOR> m_solver;
+    double m_step;
+
+    int m_num_steps;
+    double m_violation;
+    double m_colors;
+};
+
+template <int NTHREADS>
+PileTestNSC<NTHREADS>::PileTestNSC() : m_step(1e-3) {
+    int num_layers = 20;
+    int num_per_side = 12;
+    double radius = 0.1;
+
+    m_system = new ChSystemNSC();
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetNumThreads(NTHREADS, 1, 1);
+
+    m_solver = chrono_types::make_shared<ChSolverPSOR>();
+    m_solver->SetMaxIterations(50);
+    m_solver->SetTolerance(0);
+    m_solver->SetNumThreads(NTHREADS);
+    m_system->SetSolver(m_solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    // Container
+    double hdim = num_per_side * radius;
+    double hthick = 0.1;
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(2 * hdim, 2 * hthick, 2 * hdim, 1000, false, true, mat);
+    floor->SetPos(ChVector3d(0, -hthick, 0));
+    floor->SetFixed(true);
+    m_system->Add(floor);
+
+    for (int i = 0; i < 4; i++) {
+        double angle = i * CH_PI_2;
+        auto wall = chrono_types::make_shared<ChBodyEasyBox>(2 * hthick, 40 * radius, 2 * hdim, 1000, false, true, mat);
+        wall->SetPos(ChVector3d((hdim + hthick) * std::cos(angle), 20 * radius, (hdim + hthick) * std::sin(angle)));
+        wall->SetRot(QuatFromAngleY(-angle));
+        wall->SetFixed(true);
+        m_system->Add(wall);
+    }
+
+    // Spheres, initialized in a jittered grid
+    for (int il = 0; il < num_layers; il++) {
+        for (int ix = 0; ix < num_per_side; ix++) {
+            for (int iz = 0; iz < num_per_side; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius * 0.95, 1000, false, true, mat);
+                double x = -hdim + (2 * ix + 1) * radius + 0.02 * radius * ChRandom::Get();
+                double z = -hdim + (2 * iz + 1) * radius + 0.02 * radius * ChRandom::Get();
+                ball->SetPos(ChVector3d(x, (2 * il + 1) * radius, z));
+                m_system->Add(ball);
+            }
+        }
+    }
+
+    ResetStats();
+}
+
+template <int NTHREADS>
+void PileTestNSC<NTHREADS>::ExecuteStep() {
+    m_system->DoStepDynamics(m_step);
+    m_num_steps++;
+    m_violation += m_solver->GetError();
+    m_colors += m_solver->GetColoring().GetNumColors();
+}
+
+template <int NTHREADS>
+void PileTestNSC<NTHREADS>::ResetStats() {
+    m_num_steps = 0;
+    m_violation = 0;
+    m_colors = 0;
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for each benchmark
+
+#define CH_BM_PILE(TEST_NAME, NTHREADS)                                                  \
+    using TEST_NAME = utils::ChBenchmarkFixture<PileTestNSC<NTHREADS>, NUM_SKIP_STEPS>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                \
+        m_test->ResetStats();                                                            \
+        while (st.KeepRunning()) {                                                       \
+            m_test->Simulate(NUM_SIM_STEPS);                                             \
+        }                                                                                \
+        Report(st);                                                                      \
+        st.counters["Violation"] = m_test->GetAverageViolation();                        \
+        st.counters["Colors"] = m_test->GetAverageColors();                              \
+    }                                                                                    \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(5);
+
+CH_BM_PILE(PileNSC_1thread, 1);
+CH_BM_PILE(PileNSC_2threads, 2);
+CH_BM_PILE(PileNSC_4threads, 4);
+CH_BM_PILE(PileNSC_8threads, 8);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
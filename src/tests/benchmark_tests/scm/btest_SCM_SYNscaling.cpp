@@ -87,6 +87,12 @@ const bool bulldozing = false;
 // How often SynChrono state messages are interchanged
 double heartbeat = 1e-2;  // 100[Hz]
 
+// Radius for SynChrono interest management (0: exchange state messages with all nodes)
+double interest_radius = 0;
+
+// Compress vehicle state messages (quantized, delta-encoded wheel poses)
+bool compress_state = false;
+
 // Initialize vehicles on parallel tracks (default criss-cross)
 bool parallel_tracks = false;
 
@@ -141,6 +147,8 @@ int main(int argc, char* argv[]) {
     nthreads = cli.GetAsType<int>("nthreads");
     wheel_patches = cli.GetAsType<bool>("wheel_patches");
     parallel_tracks = cli.GetAsType<bool>("parallel_tracks");
+    interest_radius = cli.GetAsType<double>("radius");
+    compress_state = cli.GetAsType<bool>("compress");
 
     chrono_collsys = cli.GetAsType<bool>("csys");
 #ifndef CHRONO_COLLISION
@@ -160,10 +168,12 @@ int main(int argc, char* argv[]) {
     if (node_id == 0) {
         std::cout << "Collision system: " << (chrono_collsys ? "Chrono" : "Bullet") << std::endl;
         std::cout << "Num SCM threads: " << nthreads << std::endl;
+        std::cout << "Interest radius: " << interest_radius << std::endl;
     }
 
     // Change SynChronoManager settings
     syn_manager.SetHeartbeat(heartbeat);
+    syn_manager.SetInterestRadius(interest_radius);
 
     // ------------------------
     // Create the Chrono system
@@ -267,6 +277,7 @@ int main(int argc, char* argv[]) {
         vehicle_agent->SetZombieVisualizationFiles("", "", "");
     }
     vehicle_agent->SetNumWheels(4);
+    vehicle_agent->EnableStateCompression(compress_state);
     syn_manager.AddAgent(vehicle_agent);
 
     // ----------------------
@@ -373,7 +384,10 @@ int main(int argc, char* argv[]) {
                 double* all_rtf = new double[num_nodes];
                 MPI_Gather(&rtf, 1, MPI_DOUBLE, all_rtf, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
                 if (node_id == 0) {
-                    std::string fname = "stats_" + std::to_string(num_nodes) + "_" + std::to_string(nthreads) + ".out";
+                    std::string fname = "stats_" + std::to_string(num_nodes) + "_" + std::to_string(nthreads);
+                    if (interest_radius > 0)
+                        fname += "_r" + std::to_string((int)interest_radius);
+                    fname += ".out";
                     std::ofstream ofile(fname, std::ios_base::app);
                     for (int i = 0; i < num_nodes; i++)
                         ofile << all_rtf[i] << "  ";
@@ -392,6 +406,7 @@ int main(int argc, char* argv[]) {
                     PrintStepStatistics(cout, sys);
                     cout << "\n[" << node_id << "] Synchrono stats for last step:" << endl;
                     syn_manager.PrintStepStatistics(cout);
+                    cout << "   Num. peers:      " << communicator->GetNumPeers() << endl;
                     cout << "\nRTF for all nodes:" << endl;
                     for (int i = 0; i < num_nodes; i++)
                         cout << all_rtf[i] << "  ";
@@ -462,6 +477,9 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<bool>("Test", "p,parallel_tracks", "Initialize vehicles on parallel tracks (false: criss-cross)",
                         std::to_string(parallel_tracks));
     cli.AddOption<int>("Test", "v,vis", "Run-time visualization rank", std::to_string(vis_rank));
+    cli.AddOption<double>("Test", "r,radius", "Interest management radius (0: all-to-all exchange)",
+                          std::to_string(interest_radius));
+    cli.AddOption<bool>("Test", "z,compress", "Compress vehicle state messages", std::to_string(compress_state));
 }
 
 void PrintStepStatistics(std::ostream& os, const ChSystem& sys) {
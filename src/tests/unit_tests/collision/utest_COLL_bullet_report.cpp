@@ -0,0 +1,170 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for multithreaded contact reporting in the Bullet collision system.
+// Checks, for different numbers of collision threads, that:
+// - the broadphase callback is invoked sequentially, once per overlapping pair
+//   and for all pairs before any narrowphase callback;
+// - the narrowphase callback is invoked sequentially, for each contact;
+// - pairs and contacts rejected by the callbacks are not reported;
+// - contacts are reported in the same order as seen by the narrowphase callback,
+//   and this order does not depend on the number of threads.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+typedef std::pair<unsigned int, unsigned int> BodyPair;
+
+static const unsigned int broad_rejected = 7;    // pairs with this body are rejected by the broadphase callback
+static const unsigned int narrow_rejected = 12;  // contacts with this body are rejected by the narrowphase callback
+
+static BodyPair GetBodies(ChCollisionModel* modelA, ChCollisionModel* modelB) {
+    return {dynamic_cast<ChBody*>(modelA->GetContactable())->GetIndex(),
+            dynamic_cast<ChBody*>(modelB->GetContactable())->GetIndex()};
+}
+
+// Sequence of callback invocations: broadphase (true) or narrowphase (false)
+struct CallbackLog {
+    std::vector<bool> events;
+    std::vector<BodyPair> broad_pairs;
+    std::vector<BodyPair> narrow_pairs;
+    bool sequential = true;
+};
+
+class BroadCallback : public ChCollisionSystem::BroadphaseCallback {
+  public:
+    BroadCallback(CallbackLog& log) : m_log(log) {}
+    virtual bool OnBroadphase(ChCollisionModel* modelA, ChCollisionModel* modelB) override {
+        m_log.sequential &= (ChOMP::GetNumThreads() == 1);
+        m_log.events.push_back(true);
+        auto bodies = GetBodies(modelA, modelB);
+        m_log.broad_pairs.push_back(bodies);
+        return bodies.first != broad_rejected && bodies.second != broad_rejected;
+    }
+    CallbackLog& m_log;
+};
+
+class NarrowCallback : public ChCollisionSystem::NarrowphaseCallback {
+  public:
+    NarrowCallback(CallbackLog& log) : m_log(log) {}
+    virtual bool OnNarrowphase(ChCollisionInfo& cinfo) override {
+        m_log.sequential &= (ChOMP::GetNumThreads() == 1);
+        m_log.events.push_back(false);
+        auto bodies = GetBodies(cinfo.modelA, cinfo.modelB);
+        if (bodies.first == narrow_rejected || bodies.second == narrow_rejected)
+            return false;
+        m_log.narrow_pairs.push_back(bodies);
+        return true;
+    }
+    CallbackLog& m_log;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        pairs.push_back({dynamic_cast<ChBody*>(contactobjA)->GetIndex(),
+                         dynamic_cast<ChBody*>(contactobjB)->GetIndex()});
+        return true;
+    }
+    std::vector<BodyPair> pairs;
+};
+
+// Grid of overlapping spheres resting on a fixed box. Run collision detection with the specified number of threads,
+// record the callback invocations and return the reported contacts.
+static std::vector<BodyPair> FindContacts(int nthreads, CallbackLog& log) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetNumThreads(1, nthreads, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+            ball->SetPos(ChVector3d(0.95 * i, 0.49, 0.95 * j));
+            sys.AddBody(ball);
+        }
+    }
+
+    sys.GetCollisionSystem()->RegisterBroadphaseCallback(chrono_types::make_shared<BroadCallback>(log));
+    sys.GetCollisionSystem()->RegisterNarrowphaseCallback(chrono_types::make_shared<NarrowCallback>(log));
+
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    return collector->pairs;
+}
+
+TEST(ChCollisionSystemBullet, report_contacts) {
+    CallbackLog log_ref;
+    auto contacts_ref = FindContacts(1, log_ref);
+
+    for (int nthreads : {1, 2, 4}) {
+        CallbackLog log;
+        auto contacts = FindContacts(nthreads, log);
+
+        // Callbacks invoked sequentially, all broadphase callbacks before the narrowphase callbacks
+        ASSERT_TRUE(log.sequential);
+        ASSERT_FALSE(log.broad_pairs.empty());
+        ASSERT_FALSE(log.narrow_pairs.empty());
+        auto first_narrow = std::find(log.events.begin(), log.events.end(), false);
+        ASSERT_TRUE(std::find(first_narrow, log.events.end(), true) == log.events.end());
+
+        // Broadphase callback invoked once per pair
+        for (size_t i = 0; i < log.broad_pairs.size(); i++)
+            for (size_t k = i + 1; k < log.broad_pairs.size(); k++)
+                ASSERT_FALSE(log.broad_pairs[i] == log.broad_pairs[k]);
+
+        // Rejected pairs and contacts are not reported
+        for (const auto& p : contacts) {
+            ASSERT_NE(p.first, broad_rejected);
+            ASSERT_NE(p.second, broad_rejected);
+            ASSERT_NE(p.first, narrow_rejected);
+            ASSERT_NE(p.second, narrow_rejected);
+        }
+
+        // Contacts reported in the order seen by the narrowphase callback
+        ASSERT_TRUE(contacts == log.narrow_pairs);
+
+        // Same callback invocations and reported contacts for any number of threads
+        ASSERT_TRUE(log.broad_pairs == log_ref.broad_pairs);
+        ASSERT_TRUE(log.narrow_pairs == log_ref.narrow_pairs);
+        ASSERT_TRUE(contacts == contacts_ref);
+    }
+}
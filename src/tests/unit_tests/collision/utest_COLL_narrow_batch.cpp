@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono unit test for batched narrowphase collision detection in the multicore
+// collision system. Contacts for a random collection of spheres and boxes must
+// match those obtained by processing each candidate pair individually.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+#include "chrono/core/ChRandom.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ContactData {
+    ChVector3d ptA;
+    ChVector3d ptB;
+    ChVector3d normal;
+    double distance;
+    double eff_radius;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, plane_coord.GetAxisX(), distance, eff_radius});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+// Create a random collection of spheres and boxes and return the contacts found by the collision system.
+static std::vector<ContactData> FindContacts(ChNarrowphase::Algorithm algorithm, bool batching) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    coll_sys->SetNarrowphaseAlgorithm(algorithm);
+    coll_sys->EnableNarrowphaseBatching(batching);
+    coll_sys->SetBroadphaseGridResolution(ChVector3i(4, 4, 4));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    ChRandom::SetSeed(11);
+    for (int i = 0; i < 300; i++) {
+        std::shared_ptr<ChBody> body;
+        if (i % 4 == 0)
+            body = chrono_types::make_shared<ChBodyEasyBox>(0.1 + 0.2 * ChRandom::Get(), 0.1 + 0.2 * ChRandom::Get(),
+                                                           0.1 + 0.2 * ChRandom::Get(), 1000, false, true, mat);
+        else
+            body = chrono_types::make_shared<ChBodyEasySphere>(0.05 + 0.1 * ChRandom::Get(), 1000, false, true, mat);
+        body->SetPos(ChVector3d(2 * ChRandom::Get(), 2 * ChRandom::Get(), 2 * ChRandom::Get()));
+        body->SetRot(QuatFromAngleAxis(CH_2PI * ChRandom::Get(),
+                                       ChVector3d(ChRandom::Get(), ChRandom::Get(), 1).GetNormalized()));
+        sys.AddBody(body);
+    }
+
+    sys.Setup();
+    sys.Update();
+    sys.ComputeCollisions();
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    return collector->contacts;
+}
+
+static void CompareContacts(ChNarrowphase::Algorithm algorithm) {
+    auto contacts_ref = FindContacts(algorithm, false);
+    auto contacts_batch = FindContacts(algorithm, true);
+
+    ASSERT_GT(contacts_ref.size(), 0u);
+    ASSERT_EQ(contacts_ref.size(), contacts_batch.size());
+    for (size_t i = 0; i < contacts_ref.size(); i++) {
+        ASSERT_NEAR((contacts_ref[i].ptA - contacts_batch[i].ptA).Length(), 0, 1e-10);
+        ASSERT_NEAR((contacts_ref[i].ptB - contacts_batch[i].ptB).Length(), 0, 1e-10);
+        ASSERT_NEAR((contacts_ref[i].normal - contacts_batch[i].normal).Length(), 0, 1e-10);
+        ASSERT_NEAR(contacts_ref[i].distance, contacts_batch[i].distance, 1e-10);
+        ASSERT_NEAR(contacts_ref[i].eff_radius, contacts_batch[i].eff_radius, 1e-10);
+    }
+}
+
+TEST(ChNarrowphaseBatch, prims) {
+    CompareContacts(ChNarrowphase::Algorithm::PRIMS);
+}
+
+TEST(ChNarrowphaseBatch, hybrid) {
+    CompareContacts(ChNarrowphase::Algorithm::HYBRID);
+}
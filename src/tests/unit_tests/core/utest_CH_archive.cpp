@@ -20,6 +20,7 @@
 
 #include "gtest/gtest.h"
 
+#include <cstring>
 #include <typeinfo>
 
 #include "chrono/serialization/ChArchive.h"
@@ -575,3 +576,123 @@ TEST(ChArchiveJSON, ChVectorDynamicTest) {
     ASSERT_DOUBLE_EQ(myVect_before.y(), myVect.y());
     ASSERT_DOUBLE_EQ(myVect_before.z(), myVect.z());
 }
+
+TEST(ChArchiveBinary, BulkArrays) {
+    std::string outputfile = std::string(::testing::UnitTest::GetInstance()->current_test_suite()->name()) + "_" +
+                             std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+                             std::string(".dat");
+
+    ChVectorDynamic<> myVect(1000);
+    ChMatrixDynamic<> myMat(7, 5);
+    std::vector<double> myDoubles(500);
+    std::vector<int> myInts(300);
+    for (int i = 0; i < myVect.size(); i++)
+        myVect[i] = 0.5 * i;
+    for (int i = 0; i < myMat.size(); i++)
+        myMat.data()[i] = 1.0 + i;
+    for (int i = 0; i < (int)myDoubles.size(); i++)
+        myDoubles[i] = -0.25 * i;
+    for (int i = 0; i < (int)myInts.size(); i++)
+        myInts[i] = 3 * i - 100;
+    double myScalar = 42.0;
+
+    {
+        std::ofstream mfileo(outputfile, std::ios::binary);
+        ChArchiveOutBinary archive_out(mfileo);
+        archive_out << CHNVP(myVect);
+        archive_out << CHNVP(myMat);
+        archive_out << CHNVP(myDoubles);
+        archive_out << CHNVP(myInts);
+        archive_out << CHNVP(myScalar);
+    }
+
+    // Stream-based binary archive
+    {
+        std::ifstream mfilei(outputfile, std::ios::binary);
+        ChArchiveInBinary archive_in(mfilei);
+        ChVectorDynamic<> vect;
+        ChMatrixDynamic<> mat;
+        std::vector<double> doubles;
+        std::vector<int> ints;
+        double scalar = 0;
+        archive_in >> CHNVP(vect, "myVect");
+        archive_in >> CHNVP(mat, "myMat");
+        archive_in >> CHNVP(doubles, "myDoubles");
+        archive_in >> CHNVP(ints, "myInts");
+        archive_in >> CHNVP(scalar, "myScalar");
+
+        ASSERT_EQ(vect, myVect);
+        ASSERT_EQ(mat, myMat);
+        ASSERT_EQ(doubles, myDoubles);
+        ASSERT_EQ(ints, myInts);
+        ASSERT_EQ(scalar, myScalar);
+    }
+
+    // Memory-mapped binary archive
+    {
+        ChArchiveInBinaryMapped archive_in(outputfile);
+        ASSERT_TRUE(archive_in.IsOpen());
+        ChVectorDynamic<> vect;
+        ChMatrixDynamic<> mat;
+        std::vector<double> doubles;
+        std::vector<int> ints;
+        double scalar = 0;
+        archive_in >> CHNVP(vect, "myVect");
+        archive_in >> CHNVP(mat, "myMat");
+        archive_in >> CHNVP(doubles, "myDoubles");
+        archive_in >> CHNVP(ints, "myInts");
+        archive_in >> CHNVP(scalar, "myScalar");
+
+        ASSERT_EQ(vect, myVect);
+        ASSERT_EQ(mat, myMat);
+        ASSERT_EQ(doubles, myDoubles);
+        ASSERT_EQ(ints, myInts);
+        ASSERT_EQ(scalar, myScalar);
+    }
+}
+
+TEST(ChArchiveBinary, MappedViews) {
+    std::string outputfile = std::string(::testing::UnitTest::GetInstance()->current_test_suite()->name()) + "_" +
+                             std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()) +
+                             std::string(".dat");
+
+    std::vector<double> myDoubles(1000);
+    std::vector<int> myInts(10);
+    for (int i = 0; i < (int)myDoubles.size(); i++)
+        myDoubles[i] = 0.1 * i;
+    for (int i = 0; i < (int)myInts.size(); i++)
+        myInts[i] = i * i;
+    double myScalar = -1.5;
+
+    {
+        std::ofstream mfileo(outputfile, std::ios::binary);
+        ChArchiveOutBinary archive_out(mfileo);
+        archive_out << CHNVP(myDoubles);
+        archive_out << CHNVP(myInts);
+        archive_out << CHNVP(myScalar);
+    }
+
+    ChArchiveInBinaryMapped archive_in(outputfile);
+    ASSERT_TRUE(archive_in.IsOpen());
+
+    size_t num_doubles = 0;
+    size_t num_ints = 0;
+    const double* doubles = archive_in.in_array_view<double>("myDoubles", num_doubles);
+    const int* ints = archive_in.in_array_view<int>("myInts", num_ints);
+    double scalar = 0;
+    archive_in >> CHNVP(scalar, "myScalar");
+
+    ASSERT_EQ(num_doubles, myDoubles.size());
+    ASSERT_EQ(num_ints, myInts.size());
+    for (size_t i = 0; i < num_doubles; i++) {
+        double val;
+        std::memcpy(&val, doubles + i, sizeof(double));  // views are not necessarily aligned
+        ASSERT_EQ(val, myDoubles[i]);
+    }
+    for (size_t i = 0; i < num_ints; i++) {
+        int val;
+        std::memcpy(&val, ints + i, sizeof(int));
+        ASSERT_EQ(val, myInts[i]);
+    }
+    ASSERT_EQ(scalar, myScalar);
+}
@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the profiler timeline tracing from OpenMP parallel regions.
+//
+// =============================================================================
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "chrono/utils/ChProfiler.h"
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+#ifndef CH_NO_PROFILE
+
+static double Work(int i) {
+    CH_PROFILE("work");
+    double sum = 0;
+    for (int k = 0; k < 1000; k++)
+        sum += std::sin(i + 0.001 * k);
+    return sum;
+}
+
+TEST(ChProfiler, parallel_trace) {
+    const int n = 200;
+
+    ChProfileManager::Reset();
+    ChProfileManager::ClearTrace();
+    ChProfileManager::EnableTrace(true);
+
+    std::vector<double> res(n);
+    {
+        CH_PROFILE("loop");
+#pragma omp parallel for num_threads(4)
+        for (int i = 0; i < n; i++) {
+            res[i] = Work(i);
+        }
+    }
+
+    ChProfileManager::EnableTrace(false);
+
+    // Every scope, on every thread, is recorded as a timeline event
+    auto stats = ChProfileManager::GetScopeStats();
+    ASSERT_EQ(stats.size(), 2u);
+    for (const auto& st : stats) {
+        if (st.name == "work") {
+            ASSERT_EQ(st.num_calls, n);
+            ASSERT_GE(st.num_threads, 1);
+            ASSERT_LE(st.min_time, st.max_time);
+            ASSERT_GE(st.max_thread_time, st.mean_thread_time);
+        } else {
+            ASSERT_EQ(st.name, "loop");
+            ASSERT_EQ(st.num_calls, 1);
+        }
+    }
+
+    // Trace file in Chrome trace event format
+    std::string filename = "profiler_trace.json";
+    ASSERT_TRUE(ChProfileManager::WriteTrace(filename));
+    std::ifstream in(filename);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string trace = buffer.str();
+    ASSERT_EQ(trace.find("{\"traceEvents\":["), 0u);
+    ASSERT_NE(trace.find("\"name\":\"work\""), std::string::npos);
+    ASSERT_NE(trace.find("\"name\":\"loop\""), std::string::npos);
+    in.close();
+    filesystem::path(filename).remove_file();
+
+    // No events are recorded while tracing is disabled
+    ChProfileManager::ClearTrace();
+    Work(0);
+    ASSERT_TRUE(ChProfileManager::GetScopeStats().empty());
+}
+
+#endif
@@ -22,6 +22,7 @@
 
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/solver/ChDirectSolverLS.h"
 
 #include "gtest/gtest.h"
 
@@ -75,3 +76,119 @@ TEST(SparseMatrix, pattern_learner) {
     ASSERT_NEAR(spmat_mirror.valuePtr()[2], 2.2, precision);
     ASSERT_NEAR(spmat_mirror.valuePtr()[3], 3.3, precision);
 }
+
+TEST(SparseMatrix, pattern_cache) {
+    ChSparsityPattern pattern;
+
+    // First pass: duplicate and unordered insertions
+    {
+        ChSparsityPatternLearner spl(4, 4);
+        spl.SetElement(0, 0, 1.0);
+        spl.SetElement(1, 2, 1.0);
+        spl.SetElement(1, 0, 1.0);
+        spl.SetElement(1, 2, 1.0);
+        spl.SetElement(2, 2, 1.0);
+        spl.SetElement(3, 3, 1.0);
+        spl.SetElement(3, 1, 1.0);
+
+        ASSERT_FALSE(spl.Learn(pattern));
+        ASSERT_EQ(pattern.GetNumUpdatedInnerVectors(), 4);
+        ASSERT_EQ(pattern.GetNumNonZeros(), 6);
+        ASSERT_EQ(pattern.GetOuterIndices(), std::vector<int>({0, 1, 3, 4, 6}));
+        ASSERT_EQ(pattern.GetInnerIndices(), std::vector<int>({0, 0, 2, 2, 1, 3}));
+    }
+
+    // Second pass: only row 2 changes
+    {
+        ChSparsityPatternLearner spl(4, 4);
+        spl.SetElement(0, 0, 1.0);
+        spl.SetElement(1, 2, 1.0);
+        spl.SetElement(1, 0, 1.0);
+        spl.SetElement(1, 2, 1.0);
+        spl.SetElement(2, 3, 1.0);
+        spl.SetElement(2, 2, 1.0);
+        spl.SetElement(3, 3, 1.0);
+        spl.SetElement(3, 1, 1.0);
+
+        ASSERT_FALSE(spl.Learn(pattern));
+        ASSERT_EQ(pattern.GetNumUpdatedInnerVectors(), 1);
+        ASSERT_EQ(pattern.GetOuterIndices(), std::vector<int>({0, 1, 3, 5, 7}));
+        ASSERT_EQ(pattern.GetInnerIndices(), std::vector<int>({0, 0, 2, 2, 3, 1, 3}));
+
+        ChSparseMatrix mat;
+        ASSERT_FALSE(pattern.Matches(mat));
+        pattern.Apply(mat);
+        ASSERT_TRUE(mat.isCompressed());
+        ASSERT_TRUE(pattern.Matches(mat));
+        ASSERT_EQ(mat.nonZeros(), 7);
+        ASSERT_EQ(mat.coeff(2, 3), 0.0);
+    }
+
+    // Third pass: same insertions, pattern reused
+    {
+        ChSparsityPatternLearner spl(4, 4);
+        spl.SetElement(0, 0, 1.0);
+        spl.SetElement(1, 2, 1.0);
+        spl.SetElement(1, 0, 1.0);
+        spl.SetElement(1, 2, 1.0);
+        spl.SetElement(2, 3, 1.0);
+        spl.SetElement(2, 2, 1.0);
+        spl.SetElement(3, 3, 1.0);
+        spl.SetElement(3, 1, 1.0);
+
+        ASSERT_TRUE(spl.Learn(pattern));
+        ASSERT_EQ(pattern.GetNumUpdatedInnerVectors(), 0);
+        ASSERT_EQ(pattern.GetNumNonZeros(), 7);
+    }
+}
+
+TEST(SparseMatrix, symbolic_reuse) {
+    const int n = 50;
+
+    auto fill = [n](ChSparseMatrix& A, double diag, bool extra) {
+        A.resize(n, n);
+        for (int i = 0; i < n; i++) {
+            A.insert(i, i) = diag;
+            if (i > 0)
+                A.insert(i, i - 1) = -1.0;
+            if (i < n - 1)
+                A.insert(i, i + 1) = -1.0;
+        }
+        if (extra) {
+            A.insert(0, n - 1) = 0.5;
+            A.insert(n - 1, 0) = 0.25;
+        }
+        A.makeCompressed();
+    };
+
+    ChSolverSparseLU solver;
+    solver.b() = ChVectorDynamic<>::Ones(n);
+
+    // Same structure, different values: a single symbolic analysis
+    for (int k = 0; k < 3; k++) {
+        double diag = 4.0 + k;
+        fill(solver.A(), diag, false);
+        ASSERT_TRUE(solver.SetupCurrent());
+        solver.SolveCurrent();
+        ASSERT_EQ(solver.GetNumSymbolicAnalyses(), 1u);
+
+        ChSparseMatrix A;
+        fill(A, diag, false);
+        ASSERT_LT((A * solver.x() - solver.b()).norm(), 1e-10);
+    }
+
+    // Different structure: a new symbolic analysis
+    fill(solver.A(), 4.0, true);
+    ASSERT_TRUE(solver.SetupCurrent());
+    solver.SolveCurrent();
+    ASSERT_EQ(solver.GetNumSymbolicAnalyses(), 2u);
+
+    ChSparseMatrix A;
+    fill(A, 4.0, true);
+    ASSERT_LT((A * solver.x() - solver.b()).norm(), 1e-10);
+
+    // Reuse disabled: a symbolic analysis at each call
+    solver.ReuseSymbolicFactorization(false);
+    ASSERT_TRUE(solver.SetupCurrent());
+    ASSERT_EQ(solver.GetNumSymbolicAnalyses(), 3u);
+}
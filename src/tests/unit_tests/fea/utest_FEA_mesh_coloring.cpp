@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the colored, multithreaded loading of element forces in ChMesh.
+// - check the number of colors for a structured quadrilateral mesh
+// - check that the multithreaded residual matches the sequential one
+// - check that, in deterministic mode, the residual is bitwise independent of the number of threads
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a structured mesh of ANCF shell elements
+static std::shared_ptr<ChMesh> CreateMesh(ChSystem& sys) {
+    const int nx = 8;
+    const int ny = 6;
+    const double dx = 0.1;
+
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    // Grid of nodes, with slightly perturbed positions so that internal forces are not zero
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= ny; j++) {
+        for (int i = 0; i <= nx; i++) {
+            ChVector3d pos(i * dx, j * dx, 0.001 * std::sin(1.0 * i + 2.0 * j));
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(pos, ChVector3d(0, 0, 1));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            int n0 = j * (nx + 1) + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[n0], nodes[n0 + 1], nodes[n0 + nx + 2], nodes[n0 + nx + 1]);
+            element->SetDimensions(dx, dx);
+            element->AddLayer(0.01, 0, mat);
+            element->SetAlphaDamp(0.0);
+            mesh->AddElement(element);
+        }
+    }
+
+    return mesh;
+}
+
+TEST(ChMesh, element_coloring) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.8));
+    auto mesh = CreateMesh(sys);
+
+    // Take one step to complete the system setup
+    sys.DoStepDynamics(1e-4);
+
+    // A structured quadrilateral mesh requires 4 colors
+    ASSERT_EQ(mesh->GetNumElementColors(), 4u);
+
+    // Compare sequential and multithreaded residuals
+    ChVectorDynamic<> R1(sys.GetNumCoordsVelLevel());
+    ChVectorDynamic<> R4(sys.GetNumCoordsVelLevel());
+    R1.setZero();
+    R4.setZero();
+
+    sys.SetNumThreads(1);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R1, 1.0);
+    sys.SetNumThreads(4);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R4, 1.0);
+
+    ASSERT_GT(R1.norm(), 0.0);
+    ASSERT_LT((R1 - R4).norm(), 1e-12 * R1.norm());
+}
+
+TEST(ChMesh, deterministic_residual) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.8));
+    sys.EnableDeterministic(true);
+    auto mesh = CreateMesh(sys);
+
+    sys.DoStepDynamics(1e-4);
+
+    // In deterministic mode, the residual must be identical for any number of threads
+    ChVectorDynamic<> R1(sys.GetNumCoordsVelLevel());
+    ChVectorDynamic<> R3(sys.GetNumCoordsVelLevel());
+    ChVectorDynamic<> R4(sys.GetNumCoordsVelLevel());
+    R1.setZero();
+    R3.setZero();
+    R4.setZero();
+
+    sys.SetNumThreads(1);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R1, 1.0);
+    sys.SetNumThreads(3);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R3, 1.0);
+    sys.SetNumThreads(4);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R4, 1.0);
+
+    ASSERT_GT(R1.norm(), 0.0);
+    for (int i = 0; i < R1.size(); i++) {
+        ASSERT_EQ(R1[i], R3[i]);
+        ASSERT_EQ(R1[i], R4[i]);
+    }
+}
@@ -25,9 +25,13 @@
 // corotational formulation in chrono::fea module.
 //
 // Successful execution of this unit test may validate: the material stiffness
-// matrix, the geometric stiffness matrix, and the gravity load
+// matrix, the geometric stiffness matrix, the gravity load, and the reuse of
+// modal reductions through the reduction cache file
 // =============================================================================
 
+#include <cstdio>
+#include <string>
+
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChLinkMate.h"
 
@@ -44,7 +48,13 @@ using namespace chrono;
 using namespace chrono::modal;
 using namespace chrono::fea;
 
-void RunCurvedBeam(bool do_modal_reduction, bool use_herting, ChVector3d& res) {
+// If use_cache is true, each modal assembly uses its own reduction cache file and num_cached returns the number of
+// modal assemblies whose reduction was loaded from the cache.
+void RunCurvedBeam(bool do_modal_reduction,
+                   bool use_herting,
+                   ChVector3d& res,
+                   bool use_cache = false,
+                   int* num_cached = nullptr) {
     // Create a Chrono::Engine physical system
     ChSystemNSC sys;
 
@@ -231,7 +241,12 @@ void RunCurvedBeam(bool do_modal_reduction, bool use_herting, ChVector3d& res) {
         auto damping_beam = ChModalDampingRayleigh(damping_alpha, damping_beta);
 
         for (int i_part = 0; i_part < n_parts; i_part++) {
+            if (use_cache)
+                modal_assembly_list.at(i_part)->SetReductionCacheFile("curved_beam_modal_" + std::to_string(i_part) +
+                                                                      ".dat");
             modal_assembly_list.at(i_part)->DoModalReduction(modal_solver, damping_beam);
+            if (num_cached && modal_assembly_list.at(i_part)->IsReductionFromCache())
+                (*num_cached)++;
         }
     }
 
@@ -267,7 +282,22 @@ int main(int argc, char* argv[]) {
     RunCurvedBeam(true, true, res_modal_Herting);
     bool check_Herting = (res_modal_Herting - res_corot).eigen().norm() < tol;
 
-    bool is_passed = check_CraigBampton && check_Herting;
+    std::cout << "\n\n4. Run modal reduction model with Craig Bampton method, reduction cache:\n";
+    for (int i_part = 0; i_part < 5; i_part++)
+        std::remove(("curved_beam_modal_" + std::to_string(i_part) + ".dat").c_str());
+    ChVector3d res_cache_write;
+    ChVector3d res_cache_read;
+    int num_cached_write = 0;
+    int num_cached_read = 0;
+    RunCurvedBeam(true, false, res_cache_write, true, &num_cached_write);
+    RunCurvedBeam(true, false, res_cache_read, true, &num_cached_read);
+    bool check_cache = num_cached_write == 0 && num_cached_read == 5 &&
+                       (res_cache_write - res_corot).eigen().norm() < tol &&
+                       (res_cache_read - res_cache_write).eigen().norm() < 1e-9;
+    for (int i_part = 0; i_part < 5; i_part++)
+        std::remove(("curved_beam_modal_" + std::to_string(i_part) + ".dat").c_str());
+
+    bool is_passed = check_CraigBampton && check_Herting && check_cache;
     std::cout << "\nUNIT TEST of modal assembly with curved beam: " << (is_passed ? "PASSED" : "FAILED") << std::endl;
 
     return !is_passed;
@@ -531,6 +531,47 @@ TEST(ChSymGenEigenvalueSolverLanczos, SymKMCqChrono) {
     ExecuteEigenSolverCallKMCq(eigen_solver, "SymKMCqChrono");
 }
 
+TEST(ChSymGenEigenvalueSolverKrylovSchur, SymConcurrentSpans) {
+    std::string refname = "SymKMCqChrono";
+
+    ChSparseMatrix A;
+    ChSparseMatrix B;
+    ChMatrixDynamic<double> sigma_mat;
+    ChMatrixDynamic<int> reqeigs_mat;
+
+    std::ifstream stream_A(utils::GetValidationDataFile(ref_dir + refname + "/" + refname + "_A.txt"));
+    std::ifstream stream_B(utils::GetValidationDataFile(ref_dir + refname + "/" + refname + "_B.txt"));
+    std::ifstream stream_sigma(utils::GetValidationDataFile(ref_dir + refname + "/" + refname + "_sigma.txt"));
+    std::ifstream stream_reqeigs(utils::GetValidationDataFile(ref_dir + refname + "/" + refname + "_reqeigs.txt"));
+
+    fast_matrix_market::read_matrix_market_eigen(stream_A, A);
+    fast_matrix_market::read_matrix_market_eigen(stream_B, B);
+    fast_matrix_market::read_matrix_market_eigen_dense(stream_sigma, sigma_mat);
+    fast_matrix_market::read_matrix_market_eigen_dense(stream_reqeigs, reqeigs_mat);
+    double sigma = sigma_mat(0, 0);
+    int reqeigs = reqeigs_mat(0, 0);
+
+    // two overlapping spans: duplicated eigenpairs must be discarded
+    std::list<std::pair<int, double>> eig_requests = {{reqeigs, sigma}, {reqeigs, sigma}};
+
+    ChSymGenEigenvalueSolverKrylovSchur eigen_solver_seq;
+    ChMatrixDynamic<double> eigvects_seq;
+    ChVectorDynamic<double> eigvals_seq;
+    int found_seq = modal::Solve<>(eigen_solver_seq, A, B, eigvects_seq, eigvals_seq, eig_requests, true, 0);
+
+    ChSymGenEigenvalueSolverKrylovSchur eigen_solver_par;
+    eigen_solver_par.num_threads = 2;
+    ChMatrixDynamic<double> eigvects_par;
+    ChVectorDynamic<double> eigvals_par;
+    int found_par = modal::Solve<>(eigen_solver_par, A, B, eigvects_par, eigvals_par, eig_requests, true, 0);
+
+    ASSERT_EQ(found_seq, reqeigs);
+    ASSERT_EQ(found_par, found_seq);
+    ASSERT_EQ(eigen_solver_par.GetNumSpans(), 2);
+    ASSERT_NEAR(GetEigenvaluesMaxDiff(eigvals_par, eigvals_seq), 0, tolerance);
+    ASSERT_NEAR(eigen_solver_par.GetMaxResidual(A, B, eigvects_par, eigvals_par), 0, tolerance);
+}
+
 TEST(ChUnsymGenEigenvalueSolverKrylovSchur, UnsymAB) {
     ExecuteEigenSolverCallAB<ChUnsymGenEigenvalueSolverKrylovSchur, std::complex<double>>(
         ChUnsymGenEigenvalueSolverKrylovSchur(chrono_types::make_shared<ChSolverSparseComplexLU>()), "UnsymAB");
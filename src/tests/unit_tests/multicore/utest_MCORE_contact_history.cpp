@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Multicore unit test for matching contacts with the contact history
+// (used for the SMC tangential displacement history and for NSC warm starting).
+// Checks that the history of persistent contacts is recovered when the contacts
+// are reordered and new contacts are inserted between steps.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono_multicore/ChDataManager.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Build the history table from the contacts at the current step (as done at the end of an SMC step):
+// history entries sorted by shape pair ID, contacts with the same shape pair kept in order.
+static void UpdateHistory(const std::vector<long long>& shapeIDs,
+                          const std::vector<double>& disp,
+                          std::vector<long long>& keys,
+                          std::vector<double>& hist_disp) {
+    std::vector<int> order(shapeIDs.size());
+    for (int i = 0; i < (int)order.size(); i++)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return shapeIDs[a] < shapeIDs[b]; });
+
+    keys.resize(order.size());
+    hist_disp.resize(order.size());
+    for (int k = 0; k < (int)order.size(); k++) {
+        keys[k] = shapeIDs[order[k]];
+        hist_disp[k] = disp[order[k]];
+    }
+}
+
+TEST(ChronoMulticore, contact_history) {
+    // Contacts at first step (two contacts between shapes of pair 20)
+    std::vector<long long> shapeIDs1 = {30, 20, 20, 10, 50};
+    std::vector<double> disp1 = {0.3, 0.21, 0.22, 0.1, 0.5};
+
+    std::vector<long long> keys;
+    std::vector<double> hist_disp;
+    UpdateHistory(shapeIDs1, disp1, keys, hist_disp);
+
+    // Contacts at second step: persistent contacts reported in a different order, new contacts (pairs 15, 40, and a
+    // third contact for pair 20) inserted between them, and the contact for pair 50 no longer active
+    std::vector<long long> shapeIDs2 = {40, 10, 20, 20, 20, 15, 30};
+    std::vector<double> expected = {0, 0.1, 0.21, 0.22, 0, 0, 0.3};
+    std::vector<bool> persistent = {false, true, true, true, false, false, true};
+
+    std::vector<int> index;
+    MatchContactHistory(shapeIDs2, (uint)shapeIDs2.size(), keys, index);
+    ASSERT_EQ(index.size(), shapeIDs2.size());
+
+    for (size_t i = 0; i < shapeIDs2.size(); i++) {
+        if (!persistent[i]) {
+            ASSERT_EQ(index[i], -1) << "contact " << i;
+            continue;
+        }
+        ASSERT_GE(index[i], 0) << "contact " << i;
+        ASSERT_EQ(keys[index[i]], shapeIDs2[i]);
+        ASSERT_EQ(hist_disp[index[i]], expected[i]) << "contact " << i;
+    }
+
+    // History carried over to the next step: entries of persistent contacts, zero for new contacts
+    std::vector<double> disp2(shapeIDs2.size(), 0.0);
+    for (size_t i = 0; i < shapeIDs2.size(); i++) {
+        if (index[i] >= 0)
+            disp2[i] = hist_disp[index[i]];
+    }
+    UpdateHistory(shapeIDs2, disp2, keys, hist_disp);
+
+    // Third step: same contacts, in reverse pair order
+    std::vector<long long> shapeIDs3 = {40, 30, 20, 20, 20, 15, 10};
+    std::vector<double> expected3 = {0, 0.3, 0.21, 0.22, 0, 0, 0.1};
+    MatchContactHistory(shapeIDs3, (uint)shapeIDs3.size(), keys, index);
+    for (size_t i = 0; i < shapeIDs3.size(); i++) {
+        ASSERT_GE(index[i], 0) << "contact " << i;
+        ASSERT_EQ(hist_disp[index[i]], expected3[i]) << "contact " << i;
+    }
+
+    // Empty history: all contacts are new
+    keys.clear();
+    MatchContactHistory(shapeIDs3, (uint)shapeIDs3.size(), keys, index);
+    for (size_t i = 0; i < shapeIDs3.size(); i++)
+        ASSERT_EQ(index[i], -1);
+}
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Chrono::Multicore unit test for deterministic collision detection.
+// The test checks that, with deterministic mode enabled (before the collision
+// system is created), the list of rigid contacts produced by the multicore
+// collision system is identical for different numbers of threads.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+struct ContactList {
+    std::vector<long long> shapeIDs;
+    std::vector<real3> pointA;
+    std::vector<real3> pointB;
+    std::vector<real> depth;
+};
+
+// Find the contacts in a pile of overlapping spheres in a box, using the specified number of threads.
+static ContactList FindContacts(int num_threads) {
+    ChSystemMulticoreNSC sys;
+    sys.EnableDeterministic(true);
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetNumThreads(num_threads);
+    sys.GetSettings()->collision.bins_per_axis = vec3(4, 4, 4);
+    sys.GetSettings()->solver.max_iteration_normal = 0;
+    sys.GetSettings()->solver.max_iteration_sliding = 10;
+    sys.GetSettings()->solver.max_iteration_spinning = 0;
+    sys.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->EnableCollision(true);
+    ground->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 4, 4, 0.2),
+                              ChFrame<>(ChVector3d(0, 0, -0.1), QUNIT));
+    sys.AddBody(ground);
+
+    double radius = 0.1;
+    for (int ix = 0; ix < 8; ix++) {
+        for (int iy = 0; iy < 8; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                auto ball = chrono_types::make_shared<ChBody>();
+                ball->SetMass(1);
+                ball->SetInertiaXX(ChVector3d(0.004, 0.004, 0.004));
+                ball->SetPos(ChVector3d(0.19 * ix + 0.01 * iz, 0.19 * iy, 0.095 + 0.19 * iz));
+                ball->EnableCollision(true);
+                ball->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, radius));
+                sys.AddBody(ball);
+            }
+        }
+    }
+
+    sys.DoStepDynamics(1e-3);
+
+    const auto& cd_data = sys.data_manager->cd_data;
+    uint num_contacts = cd_data->num_rigid_contacts;
+
+    ContactList list;
+    list.shapeIDs.assign(cd_data->contact_shapeIDs.begin(), cd_data->contact_shapeIDs.begin() + num_contacts);
+    list.pointA.assign(cd_data->cpta_rigid_rigid.begin(), cd_data->cpta_rigid_rigid.begin() + num_contacts);
+    list.pointB.assign(cd_data->cptb_rigid_rigid.begin(), cd_data->cptb_rigid_rigid.begin() + num_contacts);
+    list.depth.assign(cd_data->dpth_rigid_rigid.begin(), cd_data->dpth_rigid_rigid.begin() + num_contacts);
+
+    return list;
+}
+
+TEST(ChronoMulticore, deterministic_contacts) {
+    auto list_ref = FindContacts(1);
+    ASSERT_GT(list_ref.shapeIDs.size(), 100u);
+
+    for (int num_threads : {2, 4}) {
+        auto list = FindContacts(num_threads);
+        ASSERT_EQ(list.shapeIDs.size(), list_ref.shapeIDs.size());
+        for (size_t i = 0; i < list.shapeIDs.size(); i++) {
+            ASSERT_EQ(list.shapeIDs[i], list_ref.shapeIDs[i]);
+            ASSERT_EQ(list.pointA[i].x, list_ref.pointA[i].x);
+            ASSERT_EQ(list.pointA[i].y, list_ref.pointA[i].y);
+            ASSERT_EQ(list.pointA[i].z, list_ref.pointA[i].z);
+            ASSERT_EQ(list.pointB[i].x, list_ref.pointB[i].x);
+            ASSERT_EQ(list.pointB[i].y, list_ref.pointB[i].y);
+            ASSERT_EQ(list.pointB[i].z, list_ref.pointB[i].z);
+            ASSERT_EQ(list.depth[i], list_ref.depth[i]);
+        }
+    }
+}
@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the cache of KKT factorizations in the ADMM solver.
+// - check that results obtained with the factorization cache match those
+//   obtained without caching
+// - check that caching reduces the number of factorizations
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChSolverADMM.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ADMMResult {
+    std::vector<ChVector3d> pos;
+    int num_factorizations;
+};
+
+// Simulate a pile of spheres on a fixed plate, with a pendulum attached to the plate, using the ADMM solver with the
+// specified factorization cache size.
+static ADMMResult Simulate(int cache_size) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, false, true, mat);
+    floor->SetPos(ChVector3d(0, -0.1, 0));
+    floor->SetFixed(true);
+    sys.Add(floor);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int iy = 0; iy < 2; iy++) {
+        for (int ix = 0; ix < 3; ix++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+                ball->SetPos(ChVector3d(0.19 * ix + 0.01 * iy, 0.1 + 0.19 * iy, 0.19 * iz));
+                sys.Add(ball);
+                bodies.push_back(ball);
+            }
+        }
+    }
+
+    auto pend = chrono_types::make_shared<ChBodyEasyBox>(0.1, 0.5, 0.1, 1000, false, false);
+    pend->SetPos(ChVector3d(-1, 1, 0));
+    sys.Add(pend);
+    bodies.push_back(pend);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(floor, pend, ChFrame<>(ChVector3d(-1, 1.25, 0), QuatFromAngleX(CH_PI_2)));
+    sys.AddLink(joint);
+
+    auto solver = chrono_types::make_shared<ChSolverADMM>(chrono_types::make_shared<ChSolverSparseLU>());
+    solver->SetMaxIterations(500);
+    solver->SetToleranceDual(1e-10);
+    solver->SetTolerancePrimal(1e-10);
+    solver->SetRho(1);
+    solver->SetStepAdjustEach(1);
+    solver->SetStepAdjustPolicy(ChSolverADMM::AdmmStepType::BALANCED_UNSCALED);
+    solver->SetFactorizationCacheSize(cache_size);
+    sys.SetSolver(solver);
+
+    ADMMResult res;
+    res.num_factorizations = 0;
+    for (int i = 0; i < 20; i++) {
+        sys.DoStepDynamics(1e-3);
+        res.num_factorizations += solver->GetNumFactorizations();
+    }
+
+    for (const auto& body : bodies)
+        res.pos.push_back(body->GetPos());
+
+    return res;
+}
+
+TEST(ChSolverADMM, factorization_cache) {
+    auto res_ref = Simulate(0);
+    auto res = Simulate(4);
+
+    for (size_t i = 0; i < res.pos.size(); i++)
+        ASSERT_NEAR((res.pos[i] - res_ref.pos[i]).Length(), 0.0, 1e-6);
+
+    ASSERT_LT(res.num_factorizations, res_ref.num_factorizations);
+}
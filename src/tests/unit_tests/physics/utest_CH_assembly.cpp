@@ -25,6 +25,7 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkMotorRotationAngle.h"
 
 using namespace chrono;
 
@@ -149,3 +150,63 @@ TEST(FullAssembly, Assemble) {
     TestVector(rfrc, rfrc_ref, 1e-2);
     TestVector(rtrq, rtrq_ref, 1e-2);
 }
+
+// Create a set of pendulum chains, each driven by a rotational motor at the ground, and simulate for the specified
+// number of steps, optionally with multithreaded processing of the assembly items. Return the final system state.
+static ChState SimulateChains(bool multithreaded, int num_threads) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetNumThreads(num_threads, 1, 1);
+    sys.EnableAssemblyMultithreading(multithreaded);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double length = 0.25;
+    for (int ic = 0; ic < 8; ic++) {
+        std::shared_ptr<ChBody> prev = ground;
+        for (int ib = 0; ib < 16; ib++) {
+            auto pend = chrono_types::make_shared<ChBody>();
+            pend->SetPos(ChVector3d((ib + 0.5) * length, 0, ic * 1.0));
+            pend->SetMass(1.0);
+            pend->SetInertiaXX(ChVector3d(0.01, 0.01, 0.01));
+            sys.AddBody(pend);
+
+            if (ib == 0) {
+                auto motor = chrono_types::make_shared<ChLinkMotorRotationAngle>();
+                motor->Initialize(pend, prev, ChFrame<>(ChVector3d(0, 0, ic * 1.0)));
+                motor->SetAngleFunction(chrono_types::make_shared<ChFunctionSine>(0.5, 1.0 + ic));
+                sys.AddLink(motor);
+            } else {
+                auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+                rev->Initialize(pend, prev, ChFrame<>(ChVector3d(ib * length, 0, ic * 1.0)));
+                sys.AddLink(rev);
+            }
+
+            prev = pend;
+        }
+    }
+
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(1e-3);
+
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    double T;
+    sys.StateGather(x, v, T);
+
+    return x;
+}
+
+TEST(FullAssembly, Multithreading) {
+    ChState x_ref = SimulateChains(false, 1);
+
+    // Results with multithreaded assembly processing must be identical to those obtained sequentially
+    for (int num_threads : {1, 2, 4}) {
+        ChState x = SimulateChains(true, num_threads);
+        ASSERT_EQ(x.size(), x_ref.size());
+        for (int i = 0; i < x.size(); i++)
+            ASSERT_EQ(x(i), x_ref(i));
+    }
+}
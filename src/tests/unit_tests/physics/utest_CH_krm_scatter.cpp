@@ -0,0 +1,154 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the assembly of KRM blocks into a system matrix with a fixed
+// sparsity pattern (precomputed scatter locations and colored, multithreaded
+// loading). The result is compared against element-wise insertion. Also checks
+// that the scatter locations survive repeated solver setups which call the
+// sparsity pattern learner.
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+#include "chrono/solver/ChKRMBlock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Chain of variables (with one inactive variable), coupled by KRM blocks between consecutive variables and between
+// every third variable.
+class KRMChain {
+  public:
+    KRMChain(int num_vars, int dof) {
+        for (int i = 0; i < num_vars; i++) {
+            vars.push_back(std::unique_ptr<ChVariablesGeneric>(new ChVariablesGeneric(dof)));
+            vars.back()->GetMass().setIdentity();
+            vars.back()->SetDisabled(i == 7);
+        }
+
+        for (int i = 0; i < num_vars - 1; i++)
+            blocks.push_back(std::unique_ptr<ChKRMBlock>(new ChKRMBlock(vars[i].get(), vars[i + 1].get())));
+        for (int i = 0; i < num_vars - 3; i += 3)
+            blocks.push_back(std::unique_ptr<ChKRMBlock>(new ChKRMBlock(vars[i].get(), vars[i + 3].get())));
+
+        descriptor.BeginInsertion();
+        for (auto& var : vars)
+            descriptor.InsertVariables(var.get());
+        for (auto& block : blocks)
+            descriptor.InsertKRMBlock(block.get());
+        descriptor.EndInsertion();
+    }
+
+    void LoadBlocks(double scale) {
+        for (size_t ib = 0; ib < blocks.size(); ib++) {
+            auto K = blocks[ib]->GetMatrix();
+            for (int r = 0; r < K.rows(); r++)
+                for (int c = 0; c < K.cols(); c++)
+                    K(r, c) = scale * (1.0 + ib + 0.1 * r + 0.01 * c);
+        }
+    }
+
+    ChSystemDescriptor descriptor;
+    std::vector<std::unique_ptr<ChVariablesGeneric>> vars;
+    std::vector<std::unique_ptr<ChKRMBlock>> blocks;
+};
+
+TEST(ChSystemDescriptor, krm_scatter) {
+    KRMChain chain(20, 3);
+    auto& descriptor = chain.descriptor;
+    descriptor.SetNumThreads(4);
+
+    auto load_blocks = [&](double scale) { chain.LoadBlocks(scale); };
+
+    // Reference matrix, assembled with element-wise insertion
+    load_blocks(1.0);
+    int n = descriptor.CountActiveVariables();
+    ChSparseMatrix Z_ref(n, n);
+    descriptor.PasteMassKRMMatrixInto(Z_ref);
+    Z_ref.makeCompressed();
+
+    // Matrix with fixed sparsity pattern, reused over multiple assemblies
+    ChSparseMatrix Z = Z_ref;
+    for (int pass = 0; pass < 3; pass++) {
+        double scale = 1.0 + pass;
+        load_blocks(scale);
+        Z.setZeroValues();
+        descriptor.PasteMassKRMMatrixInto(Z);
+        ASSERT_TRUE(Z.isCompressed());
+        ASSERT_EQ(Z.nonZeros(), Z_ref.nonZeros());
+
+        load_blocks(scale);
+        ChSparseMatrix Z_check(n, n);
+        descriptor.PasteMassKRMMatrixInto(Z_check);
+        ASSERT_LT((ChMatrixDynamic<>(Z) - ChMatrixDynamic<>(Z_check)).norm(), 1e-12);
+    }
+
+    // Matrix with the same number of non-zeros but a different sparsity pattern (one KRM entry of the first row
+    // moved to the last column). Assigning it to Z reuses the index arrays of Z in place, so the cached scatter
+    // data must be invalidated based on the matrix structure itself.
+    std::vector<Eigen::Triplet<double>> triplets;
+    bool moved = false;
+    for (int k = 0; k < Z_ref.outerSize(); k++) {
+        for (ChSparseMatrix::InnerIterator it(Z_ref, k); it; ++it) {
+            if (!moved && it.row() == 0 && it.col() > 0) {
+                triplets.push_back(Eigen::Triplet<double>(0, n - 1, 0.0));
+                moved = true;
+                continue;
+            }
+            triplets.push_back(Eigen::Triplet<double>((int)it.row(), (int)it.col(), 0.0));
+        }
+    }
+    ChSparseMatrix Z_alt(n, n);
+    Z_alt.setFromTriplets(triplets.begin(), triplets.end());
+    ASSERT_EQ(Z_alt.nonZeros(), Z_ref.nonZeros());
+
+    const int* inner = Z.innerIndexPtr();
+    Z = Z_alt;
+    ASSERT_EQ(Z.innerIndexPtr(), inner);
+
+    load_blocks(5.0);
+    Z.setZeroValues();
+    descriptor.PasteMassKRMMatrixInto(Z);
+
+    load_blocks(5.0);
+    ChSparseMatrix Z_check(n, n);
+    descriptor.PasteMassKRMMatrixInto(Z_check);
+    ASSERT_LT((ChMatrixDynamic<>(Z) - ChMatrixDynamic<>(Z_check)).norm(), 1e-12);
+}
+
+TEST(ChSystemDescriptor, krm_scatter_learner) {
+    KRMChain chain(20, 3);
+    auto& descriptor = chain.descriptor;
+
+    // The sparsity pattern learner is called at each Setup (unlocked pattern). Since the pattern does not change, the
+    // matrix structure is kept and the KRM scatter locations must be computed only once.
+    ChSolverSparseLU solver;
+    solver.UseSparsityPatternLearner(true);
+    solver.LockSparsityPattern(false);
+
+    for (int pass = 0; pass < 4; pass++) {
+        chain.LoadBlocks(1.0 + pass);
+        solver.Setup(descriptor);
+        ASSERT_EQ(descriptor.GetNumKRMScatterUpdates(), 1u);
+    }
+
+    // Check the assembled matrix against element-wise insertion
+    ChSparseMatrix Z_check(solver.GetMatrix().rows(), solver.GetMatrix().cols());
+    descriptor.BuildSystemMatrix(&Z_check, nullptr);
+    ASSERT_LT((ChMatrixDynamic<>(solver.GetMatrix()) - ChMatrixDynamic<>(Z_check)).norm(), 1e-12);
+}
@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the per-step performance counters of a Chrono system.
+// - check the ring-buffer history of built-in and user counters
+// - check streaming export to CSV and JSON
+// - check that counters cannot be added while streaming and that names are
+//   escaped in JSON output
+//
+// =============================================================================
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static int CountLines(const std::string& filename) {
+    std::ifstream in(filename);
+    std::string line;
+    int n = 0;
+    while (std::getline(in, line))
+        n++;
+    return n;
+}
+
+TEST(ChPerformanceCounters, system) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, false, true, mat);
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+    ball->SetPos(ChVector3d(0, 0.25, 0));
+    sys.AddBody(ball);
+
+    sys.EnablePerformanceCounters(true);
+    auto& counters = sys.GetPerformanceCounters();
+    counters.SetHistoryLength(10);
+    int user_id = counters.Register("user_events");
+    int alloc_id = counters.GetIndex("allocations");
+    ASSERT_GE(alloc_id, 0);
+
+    std::string csv_file = "perf_counters.csv";
+    std::string json_file = "perf_counters.json";
+    ASSERT_TRUE(counters.StartStream(csv_file));
+
+    const double step = 1e-3;
+    const int num_steps = 25;
+    for (int i = 0; i < num_steps; i++) {
+        counters.Add(user_id, 1);
+        counters.Add(user_id, i);
+        sys.DoStepDynamics(step);
+        // A block of contact objects is allocated at the first step only (the contact pool is reused afterwards)
+        ASSERT_EQ(counters.GetLastValue(alloc_id), i == 0 ? 1 : 0);
+    }
+    counters.StopStream();
+
+    // The history holds the most recent samples, oldest first
+    ASSERT_EQ(counters.GetNumSamples(), 10u);
+    ASSERT_NEAR(counters.GetTime(0), (num_steps - 9) * step, 1e-10);
+    ASSERT_NEAR(counters.GetTime(9), num_steps * step, 1e-10);
+
+    // Accumulator counters are reset after each sample
+    ASSERT_EQ(counters.GetLastValue(user_id), num_steps);
+    ASSERT_EQ(counters.GetValue(user_id, 0), num_steps - 9);
+    ASSERT_EQ(counters.GetMin(user_id), num_steps - 9);
+    ASSERT_EQ(counters.GetMax(user_id), num_steps);
+
+    // Built-in counters
+    int contacts_id = counters.GetIndex("num_contacts");
+    int step_id = counters.GetIndex("step");
+    ASSERT_GE(contacts_id, 0);
+    ASSERT_GE(step_id, 0);
+    ASSERT_GT(counters.GetLastValue(contacts_id), 0);
+    ASSERT_GT(counters.GetMean(step_id), 0);
+    ASSERT_GT(counters.GetLastValue(counters.GetIndex("solver_iterations")), 0);
+
+    // Streamed output has one line per step (plus header), history output one line per sample
+    ASSERT_EQ(CountLines(csv_file), num_steps + 1);
+    ASSERT_TRUE(counters.Write(json_file, ChPerformanceCounters::Format::JSON));
+    ASSERT_EQ(CountLines(json_file), 10);
+
+    filesystem::path(csv_file).remove_file();
+    filesystem::path(json_file).remove_file();
+}
+
+TEST(ChPerformanceCounters, stream) {
+    ChPerformanceCounters counters;
+    int id = counters.Register("a\"b\\c");
+    ASSERT_EQ(counters.GetLastValue(id), 0);
+
+    std::string csv_file = "perf_counters_stream.csv";
+    ASSERT_TRUE(counters.StartStream(csv_file));
+
+    // Existing counters can be replaced, new counters are rejected while streaming
+    ASSERT_EQ(counters.Register("a\"b\\c", []() { return 2.0; }), id);
+    ASSERT_THROW(counters.Register("other"), std::runtime_error);
+    ASSERT_EQ(counters.GetNumCounters(), 1);
+
+    counters.Sample(0.5);
+    counters.Sample(1.0);
+    counters.StopStream();
+
+    // Single header line in the streamed file
+    ASSERT_EQ(CountLines(csv_file), 3);
+
+    // Counters can be added once streaming stopped
+    ASSERT_EQ(counters.Register("other"), 1);
+    counters.Sample(1.5);
+
+    // Counter names are valid JSON strings
+    std::string json_file = "perf_counters_stream.json";
+    ASSERT_TRUE(counters.Write(json_file, ChPerformanceCounters::Format::JSON));
+    std::ifstream in(json_file);
+    std::string line;
+    std::getline(in, line);
+    in.close();
+    ASSERT_EQ(line, "{\"time\":1.5,\"a\\\"b\\\\c\":2,\"other\":0}");
+
+    filesystem::path(csv_file).remove_file();
+    filesystem::path(json_file).remove_file();
+}
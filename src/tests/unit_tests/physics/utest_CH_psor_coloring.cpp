@@ -0,0 +1,113 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the multithreaded (graph-colored) PSOR solver.
+// - check that constraint blocks with the same color do not share active variables
+// - check that results do not depend on the number of threads
+// - check that the colored sweeps converge for a settling pile of spheres
+//
+// =============================================================================
+
+#include <set>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a pile of spheres on a fixed plate and simulate it for the specified number of steps.
+static std::vector<ChVector3d> SimulatePile(int num_threads, int num_steps, std::shared_ptr<ChSolverPSOR>& solver) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(100);
+    solver->SetTolerance(1e-6);
+    solver->SetNumThreads(num_threads);
+    sys.SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, false, true, mat);
+    floor->SetPos(ChVector3d(0, -0.1, 0));
+    floor->SetFixed(true);
+    sys.Add(floor);
+
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int iy = 0; iy < 3; iy++) {
+        for (int ix = 0; ix < 5; ix++) {
+            for (int iz = 0; iz < 5; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+                ball->SetPos(ChVector3d(0.19 * ix + 0.01 * iy, 0.1 + 0.19 * iy, 0.19 * iz));
+                sys.Add(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    for (int i = 0; i < num_steps; i++) {
+        sys.DoStepDynamics(1e-3);
+
+        // Check that no two blocks with the same color act on a common active variable
+        const auto& coloring = solver->GetColoring();
+        const auto& blocks = coloring.GetBlocks();
+        const auto& constraints = sys.GetSystemDescriptor()->GetConstraints();
+        for (unsigned int c = 0; c < coloring.GetNumColors(); c++) {
+            std::set<ChVariables*> used;
+            for (unsigned int ib = coloring.GetColorStart(c); ib < coloring.GetColorStart(c + 1); ib++) {
+                std::vector<ChVariables*> vars;
+                for (unsigned int k = 0; k < blocks[ib].size; k++)
+                    constraints[blocks[ib].start + k]->AppendVariables(vars);
+                std::set<ChVariables*> block_vars;
+                for (auto var : vars) {
+                    if (var->IsActive())
+                        block_vars.insert(var);
+                }
+                for (auto var : block_vars) {
+                    EXPECT_TRUE(used.insert(var).second);
+                }
+            }
+        }
+    }
+
+    std::vector<ChVector3d> pos;
+    for (const auto& ball : balls)
+        pos.push_back(ball->GetPos());
+    return pos;
+}
+
+TEST(ChSolverPSOR, coloring) {
+    std::shared_ptr<ChSolverPSOR> solver2;
+    std::shared_ptr<ChSolverPSOR> solver4;
+    auto pos2 = SimulatePile(2, 200, solver2);
+    auto pos4 = SimulatePile(4, 200, solver4);
+
+    ASSERT_GT(solver2->GetColoring().GetNumColors(), 1u);
+    ASSERT_EQ(solver2->GetColoring().GetBlocks().size(), solver4->GetColoring().GetBlocks().size());
+
+    // The colored sweeps do not depend on the number of threads
+    for (size_t i = 0; i < pos2.size(); i++) {
+        ASSERT_EQ(pos2[i].x(), pos4[i].x());
+        ASSERT_EQ(pos2[i].y(), pos4[i].y());
+        ASSERT_EQ(pos2[i].z(), pos4[i].z());
+    }
+
+    // The pile must have settled on the plate
+    for (const auto& p : pos2)
+        ASSERT_GT(p.y(), 0.09);
+    ASSERT_LT(solver2->GetError(), 1e-2);
+}
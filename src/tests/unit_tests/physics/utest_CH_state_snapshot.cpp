@@ -0,0 +1,192 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for binary state snapshots (capture/restore of the system state).
+// - check that a simulation rolled back to a snapshot reproduces the original
+//   trajectory, with the snapshot kept in memory or read from file
+// - check that restoring into a system with a different structure fails
+// - check that link reactions are restored when the number of contacts changed
+// - check that a rolled-back simulation with contacts reproduces the original
+//   trajectory (contact forces restored as initial guess)
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChStateSnapshot.h"
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Chain pendulum integrated with HHT.
+class Pendulum {
+  public:
+    Pendulum(int num_links) {
+        sys.SetGravitationalAcceleration(ChVector3d(0, -9.8, 0));
+
+        auto ground = chrono_types::make_shared<ChBody>();
+        ground->SetFixed(true);
+        sys.AddBody(ground);
+
+        auto prev = ground;
+        for (int i = 0; i < num_links; i++) {
+            auto link = chrono_types::make_shared<ChBody>();
+            link->SetPos(ChVector3d(i + 0.5, 0, 0));
+            sys.AddBody(link);
+
+            auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+            rev->Initialize(prev, link, ChFrame<>(ChVector3d(i, 0, 0), QUNIT));
+            sys.AddLink(rev);
+
+            prev = link;
+        }
+        end = prev;
+        joint = std::static_pointer_cast<ChLinkLockRevolute>(sys.GetLinks().back());
+
+        sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+        sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    }
+
+    void Simulate(int num_steps) {
+        for (int i = 0; i < num_steps; i++)
+            sys.DoStepDynamics(1e-3);
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> end;
+    std::shared_ptr<ChLinkLockRevolute> joint;
+};
+
+TEST(ChStateSnapshot, rollback) {
+    Pendulum pend(2);
+    pend.Simulate(200);
+
+    utils::ChStateSnapshot snapshot;
+    snapshot.Capture(pend.sys);
+    ASSERT_TRUE(snapshot.IsValid());
+    ASSERT_NEAR(snapshot.GetTime(), 0.2, 1e-10);
+
+    std::string filename = "state_snapshot.dat";
+    ASSERT_TRUE(snapshot.Write(filename));
+
+    pend.Simulate(300);
+    ChVector3d pos = pend.end->GetPos();
+    ChVector3d vel = pend.end->GetPosDt();
+    double time = pend.sys.GetChTime();
+
+    // Roll back to the in-memory snapshot
+    snapshot.Restore(pend.sys);
+    ASSERT_NEAR(pend.sys.GetChTime(), 0.2, 1e-10);
+    pend.Simulate(300);
+    ASSERT_NEAR(pend.sys.GetChTime(), time, 1e-10);
+    ASSERT_LT((pend.end->GetPos() - pos).Length(), 1e-10);
+    ASSERT_LT((pend.end->GetPosDt() - vel).Length(), 1e-10);
+
+    // Roll back to the snapshot read from file
+    utils::ChStateSnapshot snapshot_file;
+    ASSERT_TRUE(snapshot_file.Read(filename));
+    snapshot_file.Restore(pend.sys);
+    pend.Simulate(300);
+    ASSERT_LT((pend.end->GetPos() - pos).Length(), 1e-10);
+    ASSERT_LT((pend.end->GetPosDt() - vel).Length(), 1e-10);
+
+    filesystem::path(filename).remove_file();
+
+    // A system with a different structure cannot be restored from this snapshot
+    Pendulum other(3);
+    other.Simulate(1);
+    ASSERT_THROW(snapshot.Restore(other.sys), std::runtime_error);
+}
+
+TEST(ChStateSnapshot, contacts) {
+    Pendulum pend(2);
+
+    // Ball falling on a fixed box, away from the pendulum
+    pend.sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    pend.sys.SetSolverType(ChSolver::Type::PSOR);
+    pend.sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 0.2, 1, 1000, false, true, mat);
+    box->SetPos(ChVector3d(0, -5.1, 5));
+    box->SetFixed(true);
+    pend.sys.AddBody(box);
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+    ball->SetPos(ChVector3d(0, -4.7, 5));
+    pend.sys.AddBody(ball);
+
+    // Capture while the ball is in the air
+    pend.Simulate(50);
+    ASSERT_EQ(pend.sys.GetNumContacts(), 0u);
+    utils::ChStateSnapshot snapshot;
+    snapshot.Capture(pend.sys);
+    ChVector3d force = pend.joint->GetReaction2().force;
+    ChVector3d ball_pos = ball->GetPos();
+
+    pend.Simulate(300);
+    ASSERT_GT(pend.sys.GetNumContacts(), 0u);
+    ASSERT_GT((pend.joint->GetReaction2().force - force).Length(), 1e-3);
+
+    // Joint reactions and Jacobians are restored although the number of contacts changed
+    snapshot.Restore(pend.sys);
+    ASSERT_LT((pend.joint->GetReaction2().force - force).Length(), 1e-10);
+    ASSERT_LT((ball->GetPos() - ball_pos).Length(), 1e-10);
+
+    // The simulation can proceed from the restored state
+    pend.Simulate(50);
+    ASSERT_GT(ball->GetPos().y(), -4.95);
+}
+
+TEST(ChStateSnapshot, contact_rollback) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(5);
+    sys.GetSolver()->AsIterative()->EnableWarmStart(true);
+
+    // Ball sliding on a fixed plate
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.2f);
+    auto plate = chrono_types::make_shared<ChBodyEasyBox>(10, 0.2, 2, 1000, false, true, mat);
+    plate->SetPos(ChVector3d(0, -0.1, 0));
+    plate->SetFixed(true);
+    sys.AddBody(plate);
+    auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+    ball->SetPos(ChVector3d(0, 0.1, 0));
+    ball->SetPosDt(ChVector3d(2, 0, 0));
+    sys.AddBody(ball);
+
+    // Capture while the ball is sliding
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(sys.GetNumContacts(), 1u);
+    utils::ChStateSnapshot snapshot;
+    snapshot.Capture(sys);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+    ChVector3d pos = ball->GetPos();
+    ChVector3d vel = ball->GetPosDt();
+
+    // The solver does not converge within a step and is warm started with the contact forces of the previous step, so
+    // the replayed trajectory matches the original one only if the contact force at capture is restored
+    snapshot.Restore(sys);
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_LT((ball->GetPos() - pos).Length(), 1e-10);
+    ASSERT_LT((ball->GetPosDt() - vel).Length(), 1e-10);
+}
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for SynChrono MPI interest management
+// - check that SCM terrain deformations sent while the two nodes are out of
+//   range are not lost once the nodes are back in range
+//
+// Must be run with 2 MPI ranks (e.g., mpirun -n 2 utest_SYN_interest)
+//
+// =============================================================================
+
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
+#include "chrono_synchrono/flatbuffer/message/SynSCMMessage.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+std::shared_ptr<SynMPICommunicator> communicator;
+
+// Define our own main here to handle the MPI setup
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+
+    communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
+
+    ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
+    if (communicator->GetRank() != 0) {
+        delete listeners.Release(listeners.default_result_printer());
+    }
+
+    int res = RUN_ALL_TESTS();
+    communicator = nullptr;
+    return res;
+}
+
+// Deformation of SCM node (i, 0), modified at step i
+static double NodeLevel(int i) {
+    return -0.01 * i;
+}
+
+TEST(SynInterest, scm_out_of_range) {
+    if (communicator->GetNumRanks() != 2)
+        GTEST_SKIP() << "requires 2 MPI ranks";
+
+    int rank = communicator->GetRank();
+    ASSERT_TRUE(communicator->EnableInterestManagement(true));
+
+    // Rank 0 modifies one SCM node at each step and sends the modified nodes only. Rank 1 moves out of range of rank 0
+    // during steps 10-19 and keeps a map of the received node levels.
+    int num_steps = 30;
+    std::map<int, double> received;
+    for (int step = 0; step < num_steps; step++) {
+        bool in_range = step < 10 || step >= 20;
+        ChVector3d center = (rank == 0 || in_range) ? ChVector3d(5.0 * rank, 0, 0) : ChVector3d(1000, 0, 0);
+        communicator->SetInterestRegion(center, 1, 10);
+
+        SynMessageList messages;
+        if (rank == 0) {
+            auto message = chrono_types::make_shared<SynSCMMessage>(AgentKey(0, 1));
+            message->modified_nodes.push_back({ChVector2i(step, 0), NodeLevel(step)});
+            messages.push_back(message);
+        }
+        communicator->AddOutgoingMessages(messages);
+        communicator->Synchronize();
+
+        for (auto& message : communicator->GetMessages()) {
+            if (auto scm_message = std::dynamic_pointer_cast<SynSCMMessage>(message)) {
+                for (const auto& node : scm_message->modified_nodes)
+                    received[node.first.x()] = node.second;
+            }
+        }
+        communicator->Reset();
+    }
+
+    communicator->EnableInterestManagement(false);
+
+    // The node map on rank 1 must match the one on rank 0, including the nodes modified while out of range
+    if (rank == 1) {
+        std::map<int, double> expected;
+        for (int step = 0; step < num_steps; step++)
+            expected[step] = NodeLevel(step);
+        ASSERT_EQ(received, expected);
+    }
+}
@@ -0,0 +1,118 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for compressed (quantized and delta-encoded) component poses in
+// SynChrono vehicle state messages
+//
+// =============================================================================
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChRotation.h"
+
+#include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+// Move a set of poses, relative to a moving reference frame
+static void Advance(std::vector<SynPose>& poses, ChFrame<>& ref, int step, std::mt19937& gen) {
+    std::uniform_real_distribution<double> U(-1, 1);
+    ref = ChFrame<>(ChVector3d(0.1 * step, 0, 0.5), QuatFromAngleZ(0.001 * step));
+    for (auto& pose : poses) {
+        ChVector3d pos = pose.GetFrame().GetPos() + ChVector3d(0.1, 0.002 * U(gen), 0);
+        ChQuaternion<> rot = pose.GetFrame().GetRot() * QuatFromAngleY(0.01 * U(gen));
+        pose = SynPose(pos, rot);
+    }
+}
+
+static void CheckPoses(const std::vector<SynPose>& expected, const std::vector<SynPose>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        const auto& q1 = expected[i].GetFrame().GetRot();
+        const auto& q2 = actual[i].GetFrame().GetRot();
+        ASSERT_NEAR((expected[i].GetFrame().GetPos() - actual[i].GetFrame().GetPos()).Length(), 0.0, 1e-4);
+        ASSERT_NEAR(std::min((q1 - q2).Length(), (q1 + q2).Length()), 0.0, 1e-4);
+    }
+}
+
+TEST(SynPoseCodec, round_trip) {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<double> U(-1, 1);
+
+    std::vector<SynPose> poses(200);
+    for (auto& pose : poses) {
+        ChVector3d axis = ChVector3d(U(gen), U(gen), U(gen)).GetNormalized();
+        pose = SynPose(ChVector3d(3 * U(gen), 2 * U(gen), U(gen)), QuatFromAngleAxis(3 * U(gen), axis));
+    }
+
+    SynPoseCodec encoder;
+    SynPoseCodec decoder;
+    SynPoseCodec late_decoder;
+    encoder.SetKeyframeInterval(10);
+
+    ChFrame<> ref;
+    int num_late = 0;
+    for (int step = 0; step < 50; step++) {
+        Advance(poses, ref, step, gen);
+
+        SynCompressedPoses compressed;
+        encoder.Encode(ref, poses, compressed);
+        ASSERT_EQ(compressed.IsKeyframe(), step % 10 == 0);
+
+        // Compressed data must be much smaller than the raw positions and rotations
+        ASSERT_LT(compressed.data.size(), poses.size() * 7 * sizeof(double) / 2);
+
+        std::vector<SynPose> decoded;
+        ASSERT_TRUE(decoder.Decode(ref, compressed, decoded));
+        CheckPoses(poses, decoded);
+
+        // A receiver joining late can only decode after the next keyframe
+        if (step >= 5) {
+            bool success = late_decoder.Decode(ref, compressed, decoded);
+            ASSERT_EQ(success, step >= 10);
+            num_late += success;
+        }
+    }
+    ASSERT_EQ(num_late, 40);
+}
+
+TEST(SynPoseCodec, state_message) {
+    std::vector<SynPose> poses(100);
+    for (size_t i = 0; i < poses.size(); i++)
+        poses[i] = SynPose(ChVector3d(0.1 * i, 1, -0.5), QuatFromAngleX(0.05 * i));
+    SynPose chassis(ChVector3d(10, 20, 1), QuatFromAngleZ(0.3));
+
+    SynPoseCodec encoder;
+    SynTrackedVehicleStateMessage sent(AgentKey(1, 1), AgentKey());
+    encoder.Encode(chassis.GetFrame(), poses, sent.compressed);
+    sent.SetState(1.5, chassis, {}, {}, {}, {});
+
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(sent.ConvertToFlatBuffers(builder));
+
+    flatbuffers::Verifier verifier(builder.GetBufferPointer(), builder.GetSize());
+    ASSERT_TRUE(verifier.VerifyBuffer<SynFlatBuffers::Message>(nullptr));
+
+    SynTrackedVehicleStateMessage received;
+    received.ConvertFromFlatBuffers(flatbuffers::GetRoot<SynFlatBuffers::Message>(builder.GetBufferPointer()));
+    ASSERT_FALSE(received.compressed.IsEmpty());
+    ASSERT_TRUE(received.compressed.IsKeyframe());
+    ASSERT_TRUE(received.track_shoes.empty());
+
+    SynPoseCodec decoder;
+    std::vector<SynPose> decoded;
+    ASSERT_TRUE(decoder.Decode(received.chassis.GetFrame(), received.compressed, decoded));
+    CheckPoses(poses, decoded);
+}
@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of height queries on RigidTerrain patches.
+// Heights and normals obtained through the mesh patch query grid are compared
+// against ray casting into the patch collision model. Heights over multiple box
+// patches, found through the terrain patch grid, are compared against the
+// expected patch heights, also after adding and removing patches.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/ChWorldFrame.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+TEST(RigidTerrain, mesh_patch_queries) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    RigidTerrain terrain(&sys);
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto patch = terrain.AddPatch(mat, ChCoordsys<>(ChVector3d(1, -2, 0.5), QuatFromAngleZ(0.3)),
+                                  GetDataFile("terrain/height_maps/bump64.bmp"), 64, 64, 0, 3, true, 0, false);
+    terrain.Initialize();
+
+    // Make sure the collision models are processed by the collision system
+    sys.DoStepDynamics(1e-3);
+
+    std::vector<ChVector3d> loc;
+    for (int i = -40; i <= 40; i++)
+        for (int j = -40; j <= 40; j++)
+            loc.push_back(ChVector3d(1 + 0.8 * i + 0.013 * j, -2 + 0.8 * j - 0.007 * i, 10));
+
+    std::vector<double> height;
+    terrain.GetHeightBatch(loc, height);
+    ASSERT_EQ(height.size(), loc.size());
+
+    int num_hits = 0;
+    for (size_t k = 0; k < loc.size(); k++) {
+        ChCollisionSystem::ChRayhitResult result;
+        sys.GetCollisionSystem()->RayHit(loc[k], loc[k] - 1000.0 * ChWorldFrame::Vertical(),
+                                         patch->GetGroundBody()->GetCollisionModel().get(), result);
+
+        double h;
+        ChVector3d n;
+        float mu;
+        terrain.GetProperties(loc[k], h, n, mu);
+        ASSERT_EQ(h, height[k]);
+
+        if (!result.hit) {
+            ASSERT_EQ(h, 0.0);
+            continue;
+        }
+
+        num_hits++;
+        ASSERT_NEAR(h, ChWorldFrame::Height(result.abs_hitPoint), 1e-4);
+        ASSERT_NEAR((n - result.abs_hitNormal).Length(), 0.0, 1e-3);
+    }
+
+    // Most query points are above the patch
+    ASSERT_GT(num_hits, (int)loc.size() / 2);
+}
+
+// Height of the highest of the box patches created below that contains the specified location (0 if none)
+static double ExpectedHeight(const ChVector3d& loc, bool with_bridge) {
+    double height = std::numeric_limits<double>::lowest();
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            if (std::abs(loc.x() - 10 * i) <= 4 && std::abs(loc.y() - 10 * j) <= 4)
+                height = std::max(height, 0.1 * (3 * i + j));
+    if (with_bridge && std::abs(loc.x() - 10) <= 15 && std::abs(loc.y() - 10) <= 1)
+        height = std::max(height, 0.5);
+    return height == std::numeric_limits<double>::lowest() ? 0.0 : height;
+}
+
+TEST(RigidTerrain, patch_lookup) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    RigidTerrain terrain(&sys);
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            terrain.AddPatch(mat, ChCoordsys<>(ChVector3d(10 * i, 10 * j, 0.1 * (3 * i + j)), QUNIT), 8, 8, 1, false,
+                             1, false);
+    terrain.Initialize();
+
+    std::vector<ChVector3d> loc;
+    for (int i = -20; i <= 60; i++)
+        for (int j = -20; j <= 60; j++)
+            loc.push_back(ChVector3d(0.5 * i + 0.01 * j, 0.5 * j - 0.01 * i, 10));
+
+    std::vector<double> height;
+    terrain.GetHeightBatch(loc, height);
+    for (size_t k = 0; k < loc.size(); k++) {
+        ASSERT_NEAR(height[k], ExpectedHeight(loc[k], false), 1e-12) << loc[k];
+        ASSERT_EQ(height[k], terrain.GetHeight(loc[k]));
+    }
+
+    // A patch added after initialization, overlapping several of the other patches
+    auto bridge = terrain.AddPatch(mat, ChCoordsys<>(ChVector3d(10, 10, 0.5), QUNIT), 30, 2, 1, false, 1, false);
+    terrain.BindPatch(bridge);
+    terrain.GetHeightBatch(loc, height);
+    for (size_t k = 0; k < loc.size(); k++)
+        ASSERT_NEAR(height[k], ExpectedHeight(loc[k], true), 1e-12) << loc[k];
+
+    terrain.RemovePatch(bridge);
+    terrain.GetHeightBatch(loc, height);
+    for (size_t k = 0; k < loc.size(); k++)
+        ASSERT_NEAR(height[k], ExpectedHeight(loc[k], false), 1e-12) << loc[k];
+}
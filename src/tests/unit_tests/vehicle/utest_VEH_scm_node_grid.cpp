@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2024 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test of the storage for modified SCM grid nodes: tile location for negative
+// grid indices, tile creation, iteration order, and per-node storage.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/terrain/SCMNodeGrid.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+TEST(SCMNodeGrid, locate) {
+    SCMNodeGrid<double> grid(4);
+
+    ChVector2i tile_ij;
+    int k;
+
+    // Floor division at tile boundaries
+    const int x[] = {-9, -8, -5, -4, -1, 0, 3, 4, 7};
+    const int t[] = {-3, -2, -2, -1, -1, 0, 0, 1, 1};
+    for (int i = 0; i < 9; i++) {
+        grid.Locate(ChVector2i(x[i], 0), tile_ij, k);
+        ASSERT_EQ(tile_ij.x(), t[i]) << "x = " << x[i];
+        ASSERT_EQ(tile_ij.y(), 0);
+        ASSERT_EQ(k, x[i] - 4 * t[i]);
+
+        grid.Locate(ChVector2i(0, x[i]), tile_ij, k);
+        ASSERT_EQ(tile_ij.x(), 0);
+        ASSERT_EQ(tile_ij.y(), t[i]) << "y = " << x[i];
+        ASSERT_EQ(k, 4 * (x[i] - 4 * t[i]));
+    }
+}
+
+TEST(SCMNodeGrid, tiles) {
+    SCMNodeGrid<double> grid(4);
+
+    grid.insert(ChVector2i(-1, -1), 1.0);
+    grid.insert(ChVector2i(-4, -4), 2.0);  // same tile as (-1,-1)
+    ASSERT_EQ(grid.size(), 2u);
+    ASSERT_EQ(grid.GetNumTiles(), 1u);
+
+    grid.insert(ChVector2i(0, -1), 3.0);   // tile (0,-1)
+    grid.insert(ChVector2i(-5, -1), 4.0);  // tile (-2,-1)
+    grid.insert(ChVector2i(-1, 0), 5.0);   // tile (-1,0)
+    ASSERT_EQ(grid.size(), 5u);
+    ASSERT_EQ(grid.GetNumTiles(), 4u);
+
+    // Inserting an existing node does not modify its record; assigning does
+    ASSERT_EQ(grid.insert(ChVector2i(-4, -4), 10.0), 2.0);
+    grid.assign(ChVector2i(0, -1), 30.0);
+    ASSERT_EQ(grid.size(), 5u);
+
+    ASSERT_EQ(grid.at(ChVector2i(-1, -1)), 1.0);
+    ASSERT_EQ(grid.at(ChVector2i(-4, -4)), 2.0);
+    ASSERT_EQ(grid.at(ChVector2i(0, -1)), 30.0);
+    ASSERT_EQ(grid.at(ChVector2i(-5, -1)), 4.0);
+    ASSERT_EQ(grid.at(ChVector2i(-1, 0)), 5.0);
+
+    // Unrecorded nodes, in existing and missing tiles
+    ASSERT_TRUE(grid.find(ChVector2i(-2, -2)) == nullptr);
+    ASSERT_TRUE(grid.find(ChVector2i(8, 8)) == nullptr);
+    const auto& cgrid = grid;
+    ASSERT_TRUE(cgrid.find(ChVector2i(-2, -2)) == nullptr);
+    ASSERT_EQ(*cgrid.find(ChVector2i(-5, -1)), 4.0);
+
+    // Record addresses remain valid as new tiles are created
+    double* rec = grid.find(ChVector2i(-1, -1));
+    for (int i = 0; i < 100; i++)
+        grid.insert(ChVector2i(4 * i, 4 * i), (double)i);
+    ASSERT_EQ(rec, grid.find(ChVector2i(-1, -1)));
+    ASSERT_EQ(*rec, 1.0);
+
+    // The tile size cannot be changed once nodes were recorded
+    ASSERT_FALSE(grid.SetTileSize(8));
+    ASSERT_EQ(grid.GetTileSize(), 4);
+    ASSERT_EQ(grid.at(ChVector2i(-5, -1)), 4.0);
+}
+
+TEST(SCMNodeGrid, iteration_order) {
+    std::vector<ChVector2i> nodes = {ChVector2i(5, 1), ChVector2i(-1, -1), ChVector2i(4, 1),
+                                     ChVector2i(-4, -4), ChVector2i(-1, -4), ChVector2i(2, 0)};
+
+    // Tiled storage: tiles in order of creation, nodes in row-major order within a tile
+    {
+        SCMNodeGrid<int> grid(4);
+        for (int i = 0; i < (int)nodes.size(); i++)
+            grid.insert(nodes[i], i);
+
+        std::vector<ChVector2i> expected = {ChVector2i(4, 1),   ChVector2i(5, 1),   // tile (1,0)
+                                            ChVector2i(-4, -4), ChVector2i(-1, -4),  // tile (-1,-1)
+                                            ChVector2i(-1, -1),                      //
+                                            ChVector2i(2, 0)};                       // tile (0,0)
+        std::vector<ChVector2i> visited;
+        grid.ForEach([&](const ChVector2i& ij, const int& val) {
+            ASSERT_TRUE(nodes[val] == ij);
+            visited.push_back(ij);
+        });
+        ASSERT_TRUE(visited == expected);
+    }
+
+    // Per-node storage: nodes in order of insertion
+    {
+        SCMNodeGrid<int> grid(1);
+        for (int i = 0; i < (int)nodes.size(); i++)
+            grid.insert(nodes[i], i);
+        grid.insert(nodes[0], 100);
+        ASSERT_EQ(grid.size(), nodes.size());
+        ASSERT_EQ(grid.GetNumTiles(), nodes.size());
+
+        std::vector<ChVector2i> visited;
+        grid.ForEach([&](const ChVector2i& ij, const int& val) {
+            ASSERT_TRUE(nodes[val] == ij);
+            visited.push_back(ij);
+        });
+        ASSERT_TRUE(visited == nodes);
+    }
+}